@@ -180,16 +180,8 @@ GenericLinkService::encodeLpFields(const ndn::PacketBase& netPkt, lp::Packet& lp
         }
     }
 
-	// chaochao 的 Tag, 注意这里添加的是这个 tag 的 Field!
-	shared_ptr<lp::ChaoChaoTag> chaoChaoTag = netPkt.getTag<lp::ChaoChaoTag>();
-    if (chaoChaoTag != nullptr) { // 如果有这个tag, 直接去拿它的值
-		lpPacket.add<lp::ChaoChaoTagField>(*chaoChaoTag);
-		// std::cout << "lp::add( tag )" << std::endl;
-    }
-    else { // 如果没有 我们去添加这个tag 并将它的字段值设置为0 
-		// std::cout << "lp::add( 0 )" << std::endl;
-        lpPacket.add<lp::ChaoChaoTagField>(0); 
-    } // 后面怎么显示没有这个tag??
+	// chaochao 的 Field: 携带缓存决策的逐跳状态 (没有设置过的包为 0)
+	lpPacket.add<lp::ChaoChaoTagField>(netPkt.getCacheDecisionState());
 
 }
 
@@ -385,7 +377,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
 
     // Increment HopCount
     if (firstPkt.has<lp::HopCountTagField>()) {
-        interest->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
+        interest->setTag(ndn::makeTag<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
     }
 
     if (m_options.enableGeoTags && firstPkt.has<lp::GeoTagField>()) {
@@ -394,7 +386,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
 
     if (firstPkt.has<lp::NextHopFaceIdField>()) {
         if (m_options.allowLocalFields) {
-            interest->setTag(make_shared<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>()));
+            interest->setTag(ndn::makeTag<lp::NextHopFaceIdTag>(firstPkt.get<lp::NextHopFaceIdField>()));
         }
         else {
             NFD_LOG_FACE_WARN("received NextHopFaceId, but local fields disabled: DROP");
@@ -413,7 +405,7 @@ GenericLinkService::decodeInterest(const Block& netPkt, const lp::Packet& firstP
     }
 
     if (firstPkt.has<lp::CongestionMarkField>()) {
-        interest->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+        interest->setTag(ndn::makeTag<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
     }
 
     if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -460,21 +452,17 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
 		// 	std::cout << "Hop count: null" << std::endl; 
 		// }
 		
-        data->setTag(make_shared<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
+        data->setTag(ndn::makeTag<lp::HopCountTag>(firstPkt.get<lp::HopCountTagField>() + 1));
     }
 
 	/**
-	 * @brief 我们把这个Tag用作LCD了先,下面的操作没用了暂时,但是先保留,这是总结节点修改tag的方法
+	 * @brief 我们把这个字段用作缓存决策策略 (LCD 等) 的逐跳状态, 见 nfd::cs::DecisionPolicy
 	 * 
 	 */
-	// chaochao 的 Tag , 中间肯定要对这个tag去处理的啊
-	if (firstPkt.has<lp::ChaoChaoTagField>()) { // 收到的包 如果有tag了
-		int tag = firstPkt.get<lp::ChaoChaoTagField>(); // 不做改变 保持上面设置的值
-		// std::cout << "firstPkt : "<< tag << std::endl; // 这说明forwarder里的设置是生效的
-        // data->setTag(make_shared<lp::ChaoChaoTag>(tag)); // 这里可以确认能够正确设置上 前面已经set了 你这里再set一次?
-
-		// 不在此处修改这个字段 --> 报错??? --> 报错的不是它,是它会影响在哪些节点缓存!
-		data->setTag(make_shared<lp::ChaoChaoTag>(firstPkt.get<lp::ChaoChaoTagField>())); 
+	// chaochao 的 Field: 不做改变, 直接恢复为 data 的缓存决策状态 (不分配 tag)
+	if (firstPkt.has<lp::ChaoChaoTagField>()) {
+		// 不在此处修改这个字段 --> 它会影响在哪些节点缓存!
+		data->setCacheDecisionState(firstPkt.get<lp::ChaoChaoTagField>());
     }
 
     if (m_options.enableGeoTags && firstPkt.has<lp::GeoTagField>()) {
@@ -497,7 +485,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
         // CachePolicy is unprivileged and does not require allowLocalFields option.
         // In case of an invalid CachePolicyType, get<lp::CachePolicyField> will throw,
         // so it's unnecessary to check here.
-        data->setTag(make_shared<lp::CachePolicyTag>(firstPkt.get<lp::CachePolicyField>()));
+        data->setTag(ndn::makeTag<lp::CachePolicyTag>(firstPkt.get<lp::CachePolicyField>()));
     }
 
     if (firstPkt.has<lp::IncomingFaceIdField>()) {
@@ -505,7 +493,7 @@ GenericLinkService::decodeData(const Block& netPkt, const lp::Packet& firstPkt,
     }
 
     if (firstPkt.has<lp::CongestionMarkField>()) {
-        data->setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+        data->setTag(ndn::makeTag<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
     }
 
     if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -552,7 +540,7 @@ GenericLinkService::decodeNack(const Block& netPkt, const lp::Packet& firstPkt,
     }
 
     if (firstPkt.has<lp::CongestionMarkField>()) {
-        nack.setTag(make_shared<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
+        nack.setTag(ndn::makeTag<lp::CongestionMarkTag>(firstPkt.get<lp::CongestionMarkField>()));
     }
 
     if (firstPkt.has<lp::NonDiscoveryField>()) {
@@ -103,26 +103,20 @@ Forwarder::~Forwarder() = default;
 void
 Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& interest)
 {
-    // chaochao 的打印过滤
-    std::string testStr = "/localhost/";
-  	std::string interestName =interest.getName().toUri();
-  	std::string::size_type idx = interestName.find(testStr);
-  	bool printFlag = false;
-  	if (idx == std::string::npos) {
-		printFlag = true;
-  	} 
+    // chaochao 的打印过滤: 只比较第一个名字分量, 不做 toUri 字符串转换
+    bool isLocalhost = scope_prefix::isLocalhost(interest.getName());
+    bool printFlag = !isLocalhost;
 
     // receive Interest
     if (printFlag)
         NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName());
     // 给interest包打上IncomingFaceId标签
-    interest.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
+    interest.setTag(ndn::makeTag<lp::IncomingFaceIdTag>(ingress.face.getId()));
     ++m_counters.nInInterests;
 
     // /localhost scope control, "localhost"前缀只用于本地通信
     // 如果face不是local, 同时interest的Name的前缀又是"localhost", 则drop
-    bool isViolatingLocalhost = ingress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL
-                                && scope_prefix::LOCALHOST.isPrefixOf(interest.getName());
+    bool isViolatingLocalhost = ingress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL && isLocalhost;
     if (isViolatingLocalhost) {
         NFD_LOG_DEBUG("onIncomingInterest in=" << ingress << " interest=" << interest.getName()
                                                << " violates /localhost");
@@ -189,6 +183,22 @@ Forwarder::onIncomingInterest(const FaceEndpoint& ingress, const Interest& inter
     }
 }
 
+void
+Forwarder::onIncomingInterests(const std::vector<IncomingInterest>& batch)
+{
+    // 先一起预取整批兴趣包的 NameTree 桶, 使各个包的 cache miss 相互重叠
+    m_batchNames.clear();
+    for (const auto& incoming : batch) {
+        m_batchNames.push_back(&incoming.interest.getName());
+    }
+    m_nameTree.prefetch(m_batchNames);
+
+    // 再按顺序逐个走单包管道, 因此结果与逐个调用 onIncomingInterest 相同
+    for (const auto& incoming : batch) {
+        this->onIncomingInterest(incoming.ingress, incoming.interest);
+    }
+}
+
 void
 Forwarder::onInterestLoop(const FaceEndpoint& ingress, const Interest& interest)
 {
@@ -203,9 +213,10 @@ Forwarder::onInterestLoop(const FaceEndpoint& ingress, const Interest& interest)
     // send Nack with reason=DUPLICATE
     // note: Don't enter outgoing Nack pipeline because it needs an in-record.
     // p2p? p2p链路的兴趣包循环相当于NACK
-    lp::Nack nack(interest);
-    nack.setReason(lp::NackReason::DUPLICATE);
-    ingress.face.sendNack(nack, ingress.endpoint);
+    // 用 make_shared 创建, 使应用的 face 无需复制即可共享它
+    auto nack = make_shared<lp::Nack>(interest);
+    nack->setReason(lp::NackReason::DUPLICATE);
+    ingress.face.sendNack(*nack, ingress.endpoint);
 }
 
 void
@@ -269,13 +280,13 @@ Forwarder::onContentStoreHit(const FaceEndpoint& ingress, const shared_ptr<pit::
     afterCsHit(interest, data); 
 
     // 数据包加tag: 入端口是CS
-    data.setTag(make_shared<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
+    data.setTag(ndn::makeTag<lp::IncomingFaceIdTag>(face::FACEID_CONTENT_STORE));
     // FIXME Should we lookup PIT for other Interests that also match the data?
 
 	// chaochao: 手动删除hop字段,这里设置可生效 → data在上面就设置了!
 	// data.setTag(make_shared<lp::HopCountTag>(0));
 	data.removeTag<lp::HopCountTag>();
-	data.removeTag<lp::ChaoChaoTag>(); // 我们自己设置的tag也有同样的问题! 
+	// 缓存决策的逐跳状态已在 Cs::find 中由 DecisionPolicy::beforeServe 处理
 
     pitEntry->isSatisfied = true; // 这是哪个pitEntry??? 命中节点上的吗?
     pitEntry->dataFreshnessPeriod =
@@ -357,24 +368,18 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
     // 给data包打上IncomingFaceId标签, 指示它从哪个接口传回来的
     // 这个tag有什么用???
     // 这里打印过滤?
-    // chaochao 的打印过滤
-    std::string testStr = "/localhost/";
-  	std::string dataName =data.getName().toUri();
-  	std::string::size_type idx = dataName.find(testStr);
-  	bool printFlag = false;
-  	if (idx == std::string::npos) {
-		printFlag = true;
-  	} 
+    // chaochao 的打印过滤: 只比较第一个名字分量, 不做 toUri 字符串转换
+    bool isLocalhost = scope_prefix::isLocalhost(data.getName());
+    bool printFlag = !isLocalhost;
     if (printFlag)
         NFD_LOG_DEBUG("onIncomingData in=" << ingress << " data=" << data.getName());
 
-    data.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
+    data.setTag(ndn::makeTag<lp::IncomingFaceIdTag>(ingress.face.getId()));
     ++m_counters.nInData;
 
     // /localhost scope control
     // 如果face不是local，同时interest的Name的前缀又是"localhost"，则drop
-    bool isViolatingLocalhost =
-      ingress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL && scope_prefix::LOCALHOST.isPrefixOf(data.getName());
+    bool isViolatingLocalhost = ingress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL && isLocalhost;
     if (isViolatingLocalhost) {
         NFD_LOG_DEBUG("onIncomingData in=" << ingress << " data=" << data.getName() << " violates /localhost");
         // (drop)
@@ -392,13 +397,8 @@ Forwarder::onIncomingData(const FaceEndpoint& ingress, const Data& data)
 
     // CS insert
     // 尝试往CS里插入data
-    // cyc: 缓存决策, 你可以直接在这里实现, 也可以在insert里面实现
-    bool cacheDecision = m_cs.insert(data);
-	if (cacheDecision) { 
-		data.setTag(make_shared<lp::ChaoChaoTag>(1)); 
-	}
-
-	// m_cs.insert(data);
+    // cyc: 缓存决策由 Cs 的 DecisionPolicy 完成, 它会更新 data 的逐跳状态 (getCacheDecisionState)
+    m_cs.insert(data);
 
     // when only one PIT entry is matched, trigger strategy: after receive Data
     // 只匹配到1个PIT条目
@@ -516,7 +516,7 @@ Forwarder::onOutgoingData(const Data& data, const FaceEndpoint& egress)
 
     // /localhost scope control
     bool isViolatingLocalhost =
-      egress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL && scope_prefix::LOCALHOST.isPrefixOf(data.getName());
+      egress.face.getScope() == ndn::nfd::FACE_SCOPE_NON_LOCAL && scope_prefix::isLocalhost(data.getName());
     if (isViolatingLocalhost) {
         NFD_LOG_DEBUG("onOutgoingData out=" << egress << " data=" << data.getName() << " violates /localhost");
         // (drop)
@@ -535,7 +535,7 @@ Forwarder::onIncomingNack(const FaceEndpoint& ingress, const lp::Nack& nack)
 {
     // receive Nack
     // 给nack包打上IncomingFaceId标签
-    nack.setTag(make_shared<lp::IncomingFaceIdTag>(ingress.face.getId()));
+    nack.setTag(ndn::makeTag<lp::IncomingFaceIdTag>(ingress.face.getId()));
     ++m_counters.nInNacks;
 
     // if multi-access or ad hoc face, drop
@@ -632,8 +632,9 @@ Forwarder::onOutgoingNack(const shared_ptr<pit::Entry>& pitEntry, const FaceEndp
 
     // create Nack packet with the Interest from in-record
     // 准备好Nack包
-    lp::Nack nackPkt(inRecord->getInterest());
-    nackPkt.setHeader(nack);
+    // 用 make_shared 创建, 使应用的 face 无需复制即可共享它
+    auto nackPkt = make_shared<lp::Nack>(inRecord->getInterest());
+    nackPkt->setHeader(nack);
 
     // erase in-record
     // 擦掉in-record
@@ -641,7 +642,7 @@ Forwarder::onOutgoingNack(const shared_ptr<pit::Entry>& pitEntry, const FaceEndp
 
     // send Nack on face
     // 给interest发Nack
-    egress.face.sendNack(nackPkt, egress.endpoint);
+    egress.face.sendNack(*nackPkt, egress.endpoint);
     ++m_counters.nOutNacks;
 }
 
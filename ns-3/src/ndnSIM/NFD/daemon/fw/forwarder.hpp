@@ -82,6 +82,14 @@ class Forwarder {
     // 即 构造函数里信号连接的 startProcessXXX函数, 在这里转到了Forwarder的onIncomingXXX了
 
   public: // forwarding entrypoints and tables;
+    /** \brief an Interest received on a face, as an element of a batch
+     *  \sa startProcessInterests
+     */
+    struct IncomingInterest {
+        FaceEndpoint ingress;
+        const Interest& interest;
+    };
+
     /** \brief start incoming Interest processing
      *  \param ingress face on which Interest is received and endpoint of the sender
      *  \param interest the incoming Interest, must be well-formed and created with make_shared
@@ -92,6 +100,18 @@ class Forwarder {
         this->onIncomingInterest(ingress, interest);
     }
 
+    /** \brief start incoming Interest processing for a batch of Interests
+     *
+     *  The result is the same as calling startProcessInterest on every element in order.
+     *  The NameTree lookups of the batch are prefetched together; Interests with names under
+     *  the same prefix then share the effective strategy cached on the NameTree.
+     */
+    void
+    startProcessInterests(const std::vector<IncomingInterest>& batch)
+    {
+        this->onIncomingInterests(batch);
+    }
+
     /** \brief start incoming Data processing
      *  \param ingress face on which Data is received and endpoint of the sender
      *  \param data the incoming Data, must be well-formed and created with make_shared
@@ -197,6 +217,10 @@ class Forwarder {
                                      VIRTUAL_WITH_TESTS void
                                      onIncomingInterest(const FaceEndpoint& ingress, const Interest& interest);
 
+    /** \brief incoming Interest pipeline for a batch of Interests
+     */
+    VIRTUAL_WITH_TESTS void onIncomingInterests(const std::vector<IncomingInterest>& batch);
+
     /** \brief Interest loop pipeline
      */
     VIRTUAL_WITH_TESTS void onInterestLoop(const FaceEndpoint& ingress, const Interest& interest);
@@ -287,6 +311,8 @@ class Forwarder {
     NetworkRegionTable m_networkRegionTable;
     shared_ptr<Face> m_csFace;
 
+    std::vector<const Name*> m_batchNames; ///< names of the batch in onIncomingInterests
+
     // allow Strategy (base class) to enter pipelines
     friend class fw::Strategy;
 };
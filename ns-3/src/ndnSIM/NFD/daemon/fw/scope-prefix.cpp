@@ -30,6 +30,19 @@ namespace scope_prefix {
 
 const Name LOCALHOST("ndn:/localhost");
 const Name LOCALHOP("ndn:/localhop");
+const Name LOCALHOST_NFD("ndn:/localhost/nfd");
+
+bool
+isLocalhost(const Name& name)
+{
+    return !name.empty() && name[0] == LOCALHOST_NFD[0];
+}
+
+bool
+isLocalhostNfd(const Name& name)
+{
+    return name.size() >= 2 && name[0] == LOCALHOST_NFD[0] && name[1] == LOCALHOST_NFD[1];
+}
 
 } // namespace scope_prefix
 } // namespace nfd
@@ -58,6 +58,25 @@ extern const Name LOCALHOST;
  */
 extern const Name LOCALHOP;
 
+/** \brief ndn:/localhost/nfd
+ *
+ *  Prefix of the NFD management protocol (commands, datasets, and notifications).
+ */
+extern const Name LOCALHOST_NFD;
+
+/** \brief determine whether \p name is under ndn:/localhost
+ *
+ *  Equivalent to LOCALHOST.isPrefixOf(name), but only compares the first name component.
+ *  This is cheap enough to be evaluated on every packet in the forwarding pipelines.
+ */
+bool
+isLocalhost(const Name& name);
+
+/** \brief determine whether \p name is under ndn:/localhost/nfd, i.e., is a management packet
+ */
+bool
+isLocalhostNfd(const Name& name);
+
 } // namespace scope_prefix
 } // namespace nfd
 
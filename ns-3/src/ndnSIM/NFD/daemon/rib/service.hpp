@@ -71,6 +71,12 @@ class Service : noncopyable {
         return m_ribManager;
     }
 
+    Rib&
+    getRib()
+    {
+        return m_rib;
+    }
+
   private:
     template <typename ConfigParseFunc>
     Service(ndn::KeyChain& keyChain, ndn::Face& face, const ConfigParseFunc& configParse);
@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-decision-policy-lcd.hpp"
+#include "fw/scope-prefix.hpp"
+
+namespace nfd {
+namespace cs {
+
+const std::string LcdDecisionPolicy::POLICY_NAME = "lcd";
+NFD_REGISTER_CS_DECISION_POLICY(LcdDecisionPolicy);
+
+constexpr uint64_t LcdDecisionPolicy::CACHED;
+
+LcdDecisionPolicy::LcdDecisionPolicy()
+  : DecisionPolicy(POLICY_NAME)
+{
+}
+
+bool
+LcdDecisionPolicy::doAdmit(const Data& data)
+{
+    // (1) 管理协议的数据不缓存, 避免影响统计
+    if (scope_prefix::isLocalhostNfd(data.getName())) {
+        return false;
+    }
+
+    // (2) 上游已经缓存过则不缓存; 生产者响应的数据, 以及缓存命中后送出的数据 (已清零) 状态都为 0
+    if (data.getCacheDecisionState() != 0) {
+        return false;
+    }
+
+    data.setCacheDecisionState(CACHED);
+    return true;
+}
+
+} // namespace cs
+} // namespace nfd
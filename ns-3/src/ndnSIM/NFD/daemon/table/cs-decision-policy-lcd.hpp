@@ -0,0 +1,60 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCD_HPP
+#define NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCD_HPP
+
+#include "cs-decision-policy.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief Leave Copy Down (LCD) cache decision policy
+ *
+ *  Data is cached only on the first node below the node that served it (the producer or a CS).
+ *  The node that caches the Data sets its cache decision state to CACHED, so that nodes further
+ *  downstream skip it; a CS hit clears the state again.
+ *
+ *  Management Data under /localhost/nfd is never cached.
+ */
+class LcdDecisionPolicy : public DecisionPolicy {
+  public:
+    LcdDecisionPolicy();
+
+  public:
+    static const std::string POLICY_NAME;
+
+    /** \brief cache decision state of Data already cached by an upstream node
+     */
+    static constexpr uint64_t CACHED = 1;
+
+  private:
+    bool doAdmit(const Data& data) override;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCD_HPP
@@ -0,0 +1,52 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCE_HPP
+#define NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCE_HPP
+
+#include "cs-decision-policy.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief Leave Copy Everywhere (LCE) cache decision policy
+ *
+ *  Every node on the delivery path caches the Data.
+ */
+class LceDecisionPolicy : public DecisionPolicy {
+  public:
+    LceDecisionPolicy();
+
+  public:
+    static const std::string POLICY_NAME;
+
+  private:
+    bool doAdmit(const Data& data) override;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_DECISION_POLICY_LCE_HPP
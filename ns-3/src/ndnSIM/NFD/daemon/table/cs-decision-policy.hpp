@@ -0,0 +1,138 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_DECISION_POLICY_HPP
+#define NFD_DAEMON_TABLE_CS_DECISION_POLICY_HPP
+
+#include "core/common.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief represents a CS cache decision (placement) policy
+ *
+ *  A cache decision policy decides whether a Data packet arriving at this node is admitted into
+ *  the CS, while the replacement policy (cs::Policy) decides which entries are evicted.
+ *
+ *  Policies that coordinate along the delivery path (e.g., LCD) keep their per-packet state in
+ *  PacketBase::getCacheDecisionState, which is carried hop-by-hop in the NDNLP header.
+ */
+class DecisionPolicy : noncopyable {
+  public: // registry
+    template <typename P>
+    static void
+    registerPolicy(const std::string& policyName = P::POLICY_NAME)
+    {
+        Registry& registry = getRegistry();
+        BOOST_ASSERT(registry.count(policyName) == 0);
+        registry[policyName] = [] { return make_unique<P>(); };
+    }
+
+    /** \return a cs::DecisionPolicy identified by \p policyName,
+     *          or nullptr if \p policyName is unknown
+     */
+    static unique_ptr<DecisionPolicy> create(const std::string& policyName);
+
+    /** \return a list of available policy names
+     */
+    static std::set<std::string> getPolicyNames();
+
+  public:
+    explicit DecisionPolicy(const std::string& policyName);
+
+    virtual ~DecisionPolicy() = default;
+
+    const std::string&
+    getName() const
+    {
+        return m_policyName;
+    }
+
+  public:
+    /** \brief invoked by CS before \p data is inserted
+     *  \return whether \p data should be admitted
+     *
+     *  This is only invoked after CS-wide admission checks (CS_ENABLE_ADMIT, capacity, and
+     *  CachePolicy NO_CACHE) have passed.
+     */
+    bool
+    admit(const Data& data)
+    {
+        return this->doAdmit(data);
+    }
+
+    /** \brief invoked by CS before \p data is returned to satisfy an Interest
+     */
+    void
+    beforeServe(const Data& data)
+    {
+        this->doBeforeServe(data);
+    }
+
+  protected:
+    /** \brief decides whether \p data should be admitted
+     *
+     *  When overridden in a subclass, a policy implementation may update the cache decision state
+     *  of \p data, which is then forwarded to downstream nodes together with \p data.
+     */
+    virtual bool doAdmit(const Data& data) = 0;
+
+    /** \brief invoked before \p data is served from the CS
+     *
+     *  The default implementation clears the cache decision state, so that downstream nodes
+     *  see the Data as if it came from the producer.
+     */
+    virtual void
+    doBeforeServe(const Data& data)
+    {
+        data.setCacheDecisionState(0);
+    }
+
+  private: // registry
+    using CreateFunc = std::function<unique_ptr<DecisionPolicy>()>;
+    using Registry = std::map<std::string, CreateFunc>; // indexed by policy name
+
+    static Registry& getRegistry();
+
+  private:
+    std::string m_policyName;
+};
+
+} // namespace cs
+} // namespace nfd
+
+/** \brief registers a CS cache decision policy
+ *  \param P a subclass of nfd::cs::DecisionPolicy
+ */
+#define NFD_REGISTER_CS_DECISION_POLICY(P)                                                                             \
+    static class NfdAuto##P##CsDecisionPolicyRegistrationClass {                                                       \
+      public:                                                                                                          \
+        NfdAuto##P##CsDecisionPolicyRegistrationClass()                                                                \
+        {                                                                                                              \
+            ::nfd::cs::DecisionPolicy::registerPolicy<P>();                                                            \
+        }                                                                                                              \
+    } g_nfdAuto##P##CsDecisionPolicyRegistrationVariable
+
+#endif // NFD_DAEMON_TABLE_CS_DECISION_POLICY_HPP
@@ -25,16 +25,82 @@
 
 #include "cs-entry.hpp"
 
+#include <ndn-cxx/encoding/zero-buffer.hpp>
+
+#include <cstring>
+
 namespace nfd {
 namespace cs {
 
+/** \brief return \p data without its Content, in a wire encoding of its own
+ *
+ *  The returned Data does not share the wire buffer of \p data, so that the buffer holding the
+ *  payload can be released.
+ */
+static shared_ptr<const Data>
+stripContent(const Data& data)
+{
+    auto stripped = make_shared<Data>(data);
+    stripped->setContent(nullptr, 0);
+    stripped->wireEncode();
+    return stripped;
+}
+
 Entry::Entry(shared_ptr<const Data> data, bool isUnsolicited)
   : m_data(std::move(data))
   , m_isUnsolicited(isUnsolicited)
 {
+    const Block& content = m_data->getContent();
+    if (content.value_size() > 0 && ndn::isZeroFilled(content.value(), content.value_size())) {
+        m_hasVirtualPayload = true;
+        m_virtualPayloadSize = content.value_size();
+        m_data = stripContent(*m_data);
+    }
+
     updateFreshUntil();
 }
 
+shared_ptr<const Data>
+Entry::makeFullData() const
+{
+    auto data = make_shared<Data>(*m_data);
+    data->setContent(ndn::getZeroBuffer(m_virtualPayloadSize));
+    data->wireEncode();
+    return data;
+}
+
+shared_ptr<const Data>
+Entry::getData() const
+{
+    if (!m_hasVirtualPayload) {
+        return m_data;
+    }
+
+    // 只有在其他地方仍持有时才复用, 否则重新创建, 使条目本身只保留包头
+    shared_ptr<const Data> fullData = m_fullData.lock();
+    if (fullData == nullptr) {
+        fullData = makeFullData();
+        m_fullData = fullData;
+    }
+    return fullData;
+}
+
+const Name&
+Entry::getFullName() const
+{
+    if (!m_hasVirtualPayload) {
+        return m_data->getFullName();
+    }
+
+    if (m_fullName.empty()) {
+        // the Data created for this is released right away, the entry does not keep its payload
+        m_fullName = this->getData()->getFullName();
+        // re-encode so that the cached name does not share the wire buffer of the whole packet
+        m_fullName.wireEncode();
+    }
+    return m_fullName;
+}
+
 bool
 Entry::isFresh() const
 {
@@ -50,7 +116,16 @@ Entry::updateFreshUntil()
 bool
 Entry::canSatisfy(const Interest& interest) const
 {
-    if (!interest.matchesData(*m_data)) {
+    const Name& name = interest.getName();
+    bool isFullNameQuery =
+      m_hasVirtualPayload && name.size() == getName().size() + 1 && name[-1].isImplicitSha256Digest();
+    if (isFullNameQuery) {
+        // Interest::matchesData would compute the digest of the Data without Content
+        if (name != getFullName() || (interest.getMustBeFresh() && getFreshnessPeriod() <= 0_ms)) {
+            return false;
+        }
+    }
+    else if (!interest.matchesData(*m_data)) {
         return false;
     }
 
@@ -61,20 +136,36 @@ Entry::canSatisfy(const Interest& interest) const
     return true;
 }
 
+bool
+Entry::isSamePacket(const Entry& other) const
+{
+    if (m_data == other.m_data) {
+        return true;
+    }
+    if (m_hasVirtualPayload != other.m_hasVirtualPayload || m_virtualPayloadSize != other.m_virtualPayloadSize) {
+        return false;
+    }
+
+    // 两个虚拟负载条目: Content 都是同样长度的全零, 只需比较去掉 Content 后的编码
+    const Block& lhs = m_data->wireEncode();
+    const Block& rhs = other.m_data->wireEncode();
+    return lhs.size() == rhs.size() && (lhs.wire() == rhs.wire() || std::memcmp(lhs.wire(), rhs.wire(), lhs.size()) == 0);
+}
+
 static int
-compareQueryWithData(const Name& queryName, const Data& data)
+compareQueryWithData(const Name& queryName, const Entry& entry)
 {
     bool queryIsFullName = !queryName.empty() && queryName[-1].isImplicitSha256Digest();
 
     int cmp =
-      queryIsFullName ? queryName.compare(0, queryName.size() - 1, data.getName()) : queryName.compare(data.getName());
+      queryIsFullName ? queryName.compare(0, queryName.size() - 1, entry.getName()) : queryName.compare(entry.getName());
 
     if (cmp != 0) { // Name without digest differs
         return cmp;
     }
 
     if (queryIsFullName) { // Name without digest equals, compare digest
-        return queryName[-1].compare(data.getFullName()[-1]);
+        return queryName[-1].compare(entry.getFullName()[-1]);
     }
     else { // queryName is a proper prefix of Data fullName
         return -1;
@@ -82,32 +173,38 @@ compareQueryWithData(const Name& queryName, const Data& data)
 }
 
 static int
-compareDataWithData(const Data& lhs, const Data& rhs)
+compareDataWithData(const Entry& lhs, const Entry& rhs)
 {
     int cmp = lhs.getName().compare(rhs.getName());
     if (cmp != 0) {
         return cmp;
     }
 
+    // Same name: usually the same packet arriving again to refresh the entry.
+    // Identical encodings have identical digests, so SHA-256 is only needed for different packets.
+    if (lhs.isSamePacket(rhs)) {
+        return 0;
+    }
+
     return lhs.getFullName()[-1].compare(rhs.getFullName()[-1]);
 }
 
 bool
 operator<(const Entry& entry, const Name& queryName)
 {
-    return compareQueryWithData(queryName, entry.getData()) > 0;
+    return compareQueryWithData(queryName, entry) > 0;
 }
 
 bool
 operator<(const Name& queryName, const Entry& entry)
 {
-    return compareQueryWithData(queryName, entry.getData()) < 0;
+    return compareQueryWithData(queryName, entry) < 0;
 }
 
 bool
 operator<(const Entry& lhs, const Entry& rhs)
 {
-    return compareDataWithData(lhs.getData(), rhs.getData()) < 0;
+    return compareDataWithData(lhs, rhs) < 0;
 }
 
 } // namespace cs
@@ -32,16 +32,21 @@ namespace nfd {
 namespace cs {
 
 /** \brief a ContentStore entry
+ *
+ *  If the Content of the stored Data is all zeros (a virtual payload, as produced by ndnSIM
+ *  applications that only model payload size), the entry keeps the Data without its Content
+ *  plus the payload length, and re-creates the Content from a shared zero buffer whenever the
+ *  entry is served.  This keeps the memory of every entry proportional to the packet headers
+ *  only, while the Data served from the CS is identical to the Data that was inserted.
  */
 class Entry {
   public: // exposed through ContentStore enumeration
     /** \brief return the stored Data
+     *  \note For an entry with a virtual payload, the Data with its Content is created by this
+     *        call. The entry does not own it: it is shared by later calls only while a caller
+     *        still holds it, and is released with the last holder.
      */
-    const Data&
-    getData() const
-    {
-        return *m_data;
-    }
+    shared_ptr<const Data> getData() const;
 
     /** \brief return stored Data name
      */
@@ -53,10 +58,22 @@ class Entry {
 
     /** \brief return full name (including implicit digest) of the stored Data
      */
-    const Name&
-    getFullName() const
+    const Name& getFullName() const;
+
+    /** \brief return FreshnessPeriod of the stored Data
+     */
+    time::milliseconds
+    getFreshnessPeriod() const
+    {
+        return m_data->getFreshnessPeriod();
+    }
+
+    /** \brief return whether the Content of the stored Data is kept as a length only
+     */
+    bool
+    hasVirtualPayload() const
     {
-        return m_data->getFullName();
+        return m_hasVirtualPayload;
     }
 
     /** \brief return whether the stored Data is unsolicited
@@ -75,6 +92,13 @@ class Entry {
      */
     bool canSatisfy(const Interest& interest) const;
 
+    /** \brief determine whether \p other stores a Data packet with the same wire encoding
+     *
+     *  This compares the encodings byte by byte, which is much cheaper than computing and
+     *  comparing the implicit digests of both packets.
+     */
+    bool isSamePacket(const Entry& other) const;
+
   public: // used by ContentStore implementation
     Entry(shared_ptr<const Data> data, bool isUnsolicited);
 
@@ -91,8 +115,17 @@ class Entry {
     }
 
   private:
-    shared_ptr<const Data> m_data; // 数据内容
+    /** \brief create the stored Data with its zero-filled Content
+     */
+    shared_ptr<const Data> makeFullData() const;
+
+  private:
+    shared_ptr<const Data> m_data; // 数据内容 (虚拟负载时不含 Content)
     bool m_isUnsolicited;          // 未经请求的数据(PIT中没有的数据就是未经请求的)
+    bool m_hasVirtualPayload = false;
+    size_t m_virtualPayloadSize = 0;
+    mutable weak_ptr<const Data> m_fullData; // 虚拟负载时仍在使用中的完整 Data (条目不持有它)
+    mutable Name m_fullName; // 虚拟负载时缓存的 full name (按需计算)
     time::steady_clock::TimePoint m_freshUntil; // Fresh截止时间, 超过这个时间 这个缓存的数据就变成"不新鲜的"了
 };
 
@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "cs-exact-index.hpp"
+#include "common/city-hash.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief initial number of slots, must be a power of 2
+ */
+static const size_t INITIAL_SLOTS = 16;
+
+ExactIndex::ExactIndex()
+{
+    this->resize(INITIAL_SLOTS);
+}
+
+size_t
+ExactIndex::computeHash(const Name& name)
+{
+    const Block& wire = name.wireEncode();
+    size_t h = static_cast<size_t>(CityHash64(reinterpret_cast<const char*>(wire.value()), wire.value_size()));
+    return h == 0 ? 1 : h;
+}
+
+void
+ExactIndex::insert(Iterator it)
+{
+    // keep the load factor at most 1/2
+    if ((m_size + 1) * 2 > m_slots.size()) {
+        this->resize(m_slots.size() * 2);
+    }
+
+    this->insertSlot({computeHash(it->getName()), it});
+    ++m_size;
+}
+
+void
+ExactIndex::insertSlot(const Slot& slot)
+{
+    size_t i = slot.hash & m_mask;
+    while (m_slots[i].hash != 0) {
+        i = (i + 1) & m_mask;
+    }
+    m_slots[i] = slot;
+}
+
+void
+ExactIndex::erase(Iterator it)
+{
+    size_t i = computeHash(it->getName()) & m_mask;
+    for (;; i = (i + 1) & m_mask) {
+        BOOST_ASSERT(m_slots[i].hash != 0);
+        if (m_slots[i].it == it) {
+            break;
+        }
+    }
+
+    // backward-shift deletion: move later slots of the probe sequence into the hole,
+    // unless that would place them before their home slot
+    for (size_t j = (i + 1) & m_mask; m_slots[j].hash != 0; j = (j + 1) & m_mask) {
+        size_t home = m_slots[j].hash & m_mask;
+        if (((j - home) & m_mask) >= ((j - i) & m_mask)) {
+            m_slots[i] = m_slots[j];
+            i = j;
+        }
+    }
+    m_slots[i] = Slot();
+    --m_size;
+}
+
+void
+ExactIndex::resize(size_t nSlots)
+{
+    BOOST_ASSERT((nSlots & (nSlots - 1)) == 0);
+
+    std::vector<Slot> oldSlots(nSlots);
+    oldSlots.swap(m_slots);
+    m_mask = nSlots - 1;
+
+    for (const Slot& slot : oldSlots) {
+        if (slot.hash != 0) {
+            this->insertSlot(slot);
+        }
+    }
+}
+
+} // namespace cs
+} // namespace nfd
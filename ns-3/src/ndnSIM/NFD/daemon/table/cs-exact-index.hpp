@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2014-2019,  Regents of the University of California,
+ *                           Arizona Board of Regents,
+ *                           Colorado State University,
+ *                           University Pierre & Marie Curie, Sorbonne University,
+ *                           Washington University in St. Louis,
+ *                           Beijing Institute of Technology,
+ *                           The University of Memphis.
+ *
+ * This file is part of NFD (Named Data Networking Forwarding Daemon).
+ * See AUTHORS.md for complete list of NFD authors and contributors.
+ *
+ * NFD is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * NFD is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * NFD, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef NFD_DAEMON_TABLE_CS_EXACT_INDEX_HPP
+#define NFD_DAEMON_TABLE_CS_EXACT_INDEX_HPP
+
+#include "cs-entry.hpp"
+
+namespace nfd {
+namespace cs {
+
+/** \brief an open-addressing hash index of CS entries by Data name
+ *
+ *  The ordered Table answers prefix lookups, but an Interest with CanBePrefix=false can only be
+ *  satisfied by Data whose name equals the Interest name. This index finds those entries with one
+ *  hash computation instead of O(log n) Name comparisons.
+ *
+ *  Entries are keyed by CityHash64 of the TLV-VALUE of the Data name, using linear probing with
+ *  backward-shift deletion. Several entries with the same name (different implicit digests)
+ *  occupy separate slots.
+ */
+class ExactIndex : noncopyable {
+  public:
+    using Iterator = Table::const_iterator;
+
+    ExactIndex();
+
+    /** \brief compute the hash value of \p name
+     *  \return a non-zero hash value
+     */
+    static size_t computeHash(const Name& name);
+
+    /** \brief add \p it to the index
+     *  \pre \p it is not in the index
+     */
+    void insert(Iterator it);
+
+    /** \brief remove \p it from the index
+     *  \pre \p it is in the index
+     */
+    void erase(Iterator it);
+
+    /** \brief find the first entry, in Table order, whose Data name equals \p name and that
+     *         satisfies \p pred
+     *  \param pred `bool f(const Entry&)`
+     *  \return the entry, or \p notFound if none matches
+     */
+    template <typename Pred>
+    Iterator
+    find(const Name& name, Iterator notFound, const Pred& pred) const
+    {
+        size_t h = computeHash(name);
+        Iterator found = notFound;
+        for (size_t i = h & m_mask; m_slots[i].hash != 0; i = (i + 1) & m_mask) {
+            const Slot& slot = m_slots[i];
+            if (slot.hash != h || slot.it->getName() != name || !pred(*slot.it)) {
+                continue;
+            }
+            if (found == notFound || *slot.it < *found) {
+                found = slot.it;
+            }
+        }
+        return found;
+    }
+
+    /** \return number of indexed entries
+     */
+    size_t
+    size() const
+    {
+        return m_size;
+    }
+
+  private:
+    struct Slot {
+        size_t hash = 0; ///< 0 indicates an empty slot
+        Iterator it;
+    };
+
+    void resize(size_t nSlots);
+
+    void insertSlot(const Slot& slot);
+
+  private:
+    std::vector<Slot> m_slots;
+    size_t m_mask;
+    size_t m_size = 0;
+};
+
+} // namespace cs
+} // namespace nfd
+
+#endif // NFD_DAEMON_TABLE_CS_EXACT_INDEX_HPP
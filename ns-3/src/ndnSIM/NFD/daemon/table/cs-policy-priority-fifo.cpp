@@ -118,7 +118,7 @@ PriorityFifoPolicy::attachQueue(EntryRef i)
     else {
         entryInfo->queueType = QUEUE_FIFO;
         entryInfo->moveStaleEventId =
-          getScheduler().schedule(i->getData().getFreshnessPeriod(), [=] { moveToStaleQueue(i); });
+          getScheduler().schedule(i->getFreshnessPeriod(), [=] { moveToStaleQueue(i); });
     }
 
     Queue& queue = m_queues[entryInfo->queueType];
@@ -26,6 +26,7 @@
 #include "cs.hpp"
 #include "common/logger.hpp"
 #include "core/algorithm.hpp"
+#include "fw/scope-prefix.hpp"
 
 #include <ndn-cxx/lp/tags.hpp>
 #include <ndn-cxx/util/concepts.hpp>
@@ -41,8 +42,15 @@ makeDefaultPolicy()
     return Policy::create("lru");
 }
 
+static unique_ptr<DecisionPolicy>
+makeDefaultDecisionPolicy()
+{
+    return DecisionPolicy::create("lce");
+}
+
 // who called this constructor ?  Forwarder's constructor
 Cs::Cs(size_t nMaxPackets)
+  : m_decisionPolicy(makeDefaultDecisionPolicy())
 {
 	// std::cout << "Cs::Cs()  --> default " << nMaxPackets << std::endl;
     setPolicyImpl(makeDefaultPolicy());
@@ -69,9 +77,9 @@ Cs::insert(const Data& data, bool isUnsolicited)
     }
 
 	// cache decision
-	bool cacheDecRes = cacheDecisionImpl(data);
-	if (!cacheDecRes) 
+	if (!m_decisionPolicy->admit(data)) {
 		return false;
+	}
 
 	// 后面的emplace, 这才是真正的缓存插入!
 	NFD_LOG_DEBUG("insert " << data.getName());
@@ -89,6 +97,7 @@ Cs::insert(const Data& data, bool isUnsolicited)
         m_policy->afterRefresh(it); 
     } 
 	else { // 如果是新的包 -> 插入缓存队列
+		m_exactIndex.insert(it);
 		m_policy->afterInsert(it); // cyc: 和 m_table 的区别 ? 这里两个表都在维护 CS ?
 	}
 	return true;
@@ -114,6 +123,7 @@ Cs::eraseImpl(const Name& prefix, size_t limit)
     size_t nErased = 0;
     while (i != last && nErased < limit) {
         m_policy->beforeErase(i);
+        m_exactIndex.erase(i);
         i = m_table.erase(i);
         ++nErased;
     }
@@ -134,24 +144,27 @@ Cs::findImpl(const Interest& interest) const
     // 	std::cout << "\t" << (*it).getName() << " " << std::endl;
 
     const Name& prefix = interest.getName();
-    auto range = findPrefixRange(prefix);
+    auto canSatisfy = [&interest](const Entry& entry) { return entry.canSatisfy(interest); };
 
-	// 这里是在查 m_table
-	auto match =
-      std::find_if(range.first, range.second, [&interest](const auto& entry) { return entry.canSatisfy(interest); });
+    const_iterator match = m_table.end();
+    bool isFullName = !prefix.empty() && prefix[-1].isImplicitSha256Digest();
+    if (!interest.getCanBePrefix() && !isFullName) {
+        // 精确匹配: 只有名字完全相同的 Data 能满足, 查哈希索引, 不用在 m_table 上二分比较名字
+        match = m_exactIndex.find(prefix, m_table.end(), canSatisfy);
+    }
+    else {
+        // 这里是在查 m_table
+        auto range = findPrefixRange(prefix);
+        auto it = std::find_if(range.first, range.second, canSatisfy);
+        if (it != range.second) {
+            match = it;
+        }
+    }
 
     // 这里好像不只在匹配兴趣??? 是的
 	// 我们对打印作一些更改,设置为只打印内容相关的查询log
-	std::string testStr = "/localhost/nfd/";
-  	std::string interestName =prefix.toUri();
-  	std::string::size_type idx = interestName.find(testStr);
-  	bool printFlag = false;
-  	if (idx == std::string::npos) {
-		printFlag = true;
-  	} 
-
-    if (match == range.second) {
-		if (printFlag)
+    if (match == m_table.end()) {
+		if (!scope_prefix::isLocalhostNfd(prefix))
 			NFD_LOG_DEBUG("find " << prefix << " no-match");
         return m_table.end();
     }
@@ -186,6 +199,14 @@ Cs::setPolicy(unique_ptr<Policy> policy)
     m_policy->setLimit(limit);
 }
 
+void
+Cs::setDecisionPolicy(unique_ptr<DecisionPolicy> policy)
+{
+    BOOST_ASSERT(policy != nullptr);
+    NFD_LOG_DEBUG("set-decision-policy " << policy->getName());
+    m_decisionPolicy = std::move(policy);
+}
+
 void
 Cs::setPolicyImpl(unique_ptr<Policy> policy)
 {
@@ -193,7 +214,10 @@ Cs::setPolicyImpl(unique_ptr<Policy> policy)
 	// 构造函数会调用 1 次, 后面setPolicy会删除前面构造时设置的那个
     // NFD_LOG_DEBUG("set-policy " << policy->getName());
     m_policy = std::move(policy);
-    m_beforeEvictConnection = m_policy->beforeEvict.connect([this](auto it) { m_table.erase(it); });
+    m_beforeEvictConnection = m_policy->beforeEvict.connect([this](auto it) {
+        m_exactIndex.erase(it);
+        m_table.erase(it);
+    });
 
     m_policy->setCs(this);
     BOOST_ASSERT(m_policy->getCs() == this);
@@ -219,44 +243,5 @@ Cs::enableServe(bool shouldServe)
     NFD_LOG_INFO((shouldServe ? "Enabling" : "Disabling") << " Data serving");
 }
 
-// chaochao added ↓
-
-bool
-Cs::cacheDecisionImpl(const Data& data)
-{
-	return true; // LCE
-	// return cacheDecisionLCD(data); // LCD
-}
-
-bool
-Cs::cacheDecisionLCD(const Data& data) 
-{
-	// (1) if management protocol --> not insert
-	bool isData = true;
-	std::string testStr = "/localhost/nfd/";
-  	std::string dataName = data.getName().toUri();
-  	std::string::size_type idx = dataName.find(testStr);
-  	if (idx != std::string::npos) { // match ---> 即不是常规data项
-		isData = false;
-		// m_policy->afterInsert(it); // 直接缓存 or 全部不缓存,避免对我们的统计造成影响!
-		return false;
-	}
-
-	// (2) content  
-	auto chaochaoTag = data.getTag<lp::ChaoChaoTag>();  // Tag 是指针, 直接打印的输出是地址!
-	int cc_tag = 0;
-	if (chaochaoTag != nullptr) { 
-		cc_tag = *chaochaoTag;
-	} 
-	// NFD_LOG_DEBUG("cc_tag: " << cc_tag); 
-	if (cc_tag == 0) { // 有2种情形: (1) Producer响应数据,tag为null; (2) 缓存节点响应,*tag为0
-		// m_policy->afterInsert(it); // 后面操作的都是m_queue了! 所以insert在此之前可能就完成了? 这里都是after了?
-		return true;
-	} else {
-		return false; 
-	}
-}
-
-
 } // namespace cs
 } // namespace nfd
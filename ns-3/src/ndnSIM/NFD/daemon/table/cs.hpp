@@ -27,6 +27,8 @@
 #define NFD_DAEMON_TABLE_CS_HPP
 
 #include "cs-policy.hpp"
+#include "cs-decision-policy.hpp"
+#include "cs-exact-index.hpp"
 
 namespace nfd {
 namespace cs {
@@ -38,6 +40,7 @@ namespace cs {
  *  The Table is a container ( \c std::set ) sorted by full Names of stored Data packets.
  *  Data packets are wrapped in Entry objects. Each Entry contains the Data packet itself,
  *  and a few additional attributes such as when the Data becomes non-fresh.
+ *  Lookups of Interests with CanBePrefix=false go through an ExactIndex on Data names instead.
  *
  *  The replacement policy is implemented in a subclass of \c Policy.
  */
@@ -102,8 +105,14 @@ class Cs : noncopyable {
 		// 	std::cout << "chaochao match: " << *tag << std::endl;
 		// }
 
+		// 虚拟负载的条目在这里重建完整的 Data
+        auto data = match->getData();
+
+		// 命中: 由缓存决策策略更新 (清零) 逐跳状态
+        m_decisionPolicy->beforeServe(*data);
+
 		// Forwarder::OnContentStoreHit()
-        hit(interest, match->getData());
+        hit(interest, *data);
     }
 
     /** \brief get number of stored packets
@@ -149,6 +158,18 @@ class Cs : noncopyable {
     // 更改缓存替换策略 (必须size() == 0才能执行)
     void setPolicy(unique_ptr<Policy> policy);
 
+    /** \brief get cache decision policy
+     */
+    DecisionPolicy*
+    getDecisionPolicy() const
+    {
+        return m_decisionPolicy.get();
+    }
+
+    /** \brief change cache decision policy
+     */
+    void setDecisionPolicy(unique_ptr<DecisionPolicy> policy);
+
     /** \brief get CS_ENABLE_ADMIT flag
      *  \sa https://redmine.named-data.net/projects/nfd/wiki/CsMgmt#Update-config
      */
@@ -198,12 +219,6 @@ class Cs : noncopyable {
 
 
 
-  public: // caching strategy ---> chaochao
-	bool cacheDecisionImpl(const Data& data);
-	bool cacheDecisionLCD(const Data& data);
-
-
-
   private:
     // 用Table进行二分查找，获得前缀为prefix的区间
     std::pair<const_iterator, const_iterator> findPrefixRange(const Name& prefix) const;
@@ -222,7 +237,9 @@ class Cs : noncopyable {
 
   private:
     Table m_table;               // 存CS内容的表   这两个之间是什么关系? CS的维护 & 缓存插入/逐出, 这些由谁来负责 ?
+    ExactIndex m_exactIndex;     // m_table 的哈希索引, 用于 CanBePrefix=false 的精确查找
     unique_ptr<Policy> m_policy; // 存缓存(替换)策略
+    unique_ptr<DecisionPolicy> m_decisionPolicy; // 缓存决策策略 (LCE, LCD, ...)
     signal::ScopedConnection m_beforeEvictConnection;
 
     bool m_shouldAdmit = true; ///< if false, no Data will be admitted
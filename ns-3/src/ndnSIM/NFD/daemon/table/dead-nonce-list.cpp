@@ -24,7 +24,7 @@
  */
 
 #include "dead-nonce-list.hpp"
-#include "common/city-hash.hpp"
+#include "name-tree-hashtable.hpp"
 #include "common/global.hpp"
 #include "common/logger.hpp"
 
@@ -43,10 +43,12 @@ const double DeadNonceList::CAPACITY_UP = 1.2;
 const double DeadNonceList::CAPACITY_DOWN = 0.9;
 const size_t DeadNonceList::EVICT_LIMIT = 1 << 6;
 
+/// initial size of Queue buffer and minimum number of Hashtable slots
+static const size_t MIN_TABLE_SIZE = 1 << 4;
+
 DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
   : m_lifetime(lifetime)
-  , m_queue(m_index.get<0>())
-  , m_ht(m_index.get<1>())
+  , m_nMarks(0)
   , m_capacity(INITIAL_CAPACITY)
   , m_markInterval(m_lifetime / EXPECTED_MARK_COUNT)
   , m_adjustCapacityInterval(m_lifetime)
@@ -57,6 +59,7 @@ DeadNonceList::DeadNonceList(time::nanoseconds lifetime)
 
     for (size_t i = 0; i < EXPECTED_MARK_COUNT; ++i) {
         m_queue.push_back(MARK);
+        ++m_nMarks;
     }
 
     m_markEvent = getScheduler().schedule(m_markInterval, [this] { mark(); });
@@ -90,7 +93,7 @@ bool
 DeadNonceList::has(const Name& name, uint32_t nonce) const
 {
     Entry entry = DeadNonceList::makeEntry(name, nonce);
-    return m_ht.find(entry) != m_ht.end();
+    return m_ht.has(entry);
 }
 
 void
@@ -98,6 +101,7 @@ DeadNonceList::add(const Name& name, uint32_t nonce)
 {
     Entry entry = DeadNonceList::makeEntry(name, nonce);
     m_queue.push_back(entry);
+    m_ht.insert(entry);
 
     this->evictEntries();
 }
@@ -105,21 +109,33 @@ DeadNonceList::add(const Name& name, uint32_t nonce)
 DeadNonceList::Entry
 DeadNonceList::makeEntry(const Name& name, uint32_t nonce)
 {
-    Block nameWire = name.wireEncode();
-    return CityHash64WithSeed(reinterpret_cast<const char*>(nameWire.wire()), nameWire.size(),
-                              static_cast<uint64_t>(nonce));
+    // computeHashes memoizes on the Name, so that the PIT lookup of this Interest reuses it.
+    // Each NameTree hash XORs the component hashes and does not depend on their order,
+    // so the whole prefix sequence is folded in order: /A/B and /B/A differ at prefix 1
+    uint64_t h = 0;
+    for (name_tree::HashValue prefixHash : name_tree::computeHashes(name)) {
+        h = (h ^ prefixHash) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    // splitmix64 finalizer, so that close nonces give unrelated entries
+    Entry entry = h + (static_cast<uint64_t>(nonce) + 1) * 0x9e3779b97f4a7c15ULL;
+    entry = (entry ^ (entry >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    entry = (entry ^ (entry >> 27)) * 0x94d049bb133111ebULL;
+    entry ^= entry >> 31;
+    return entry == MARK ? MARK + 1 : entry;
 }
 
 size_t
 DeadNonceList::countMarks() const
 {
-    return m_ht.count(MARK);
+    return m_nMarks;
 }
 
 void
 DeadNonceList::mark()
 {
     m_queue.push_back(MARK);
+    ++m_nMarks;
     size_t nMarks = this->countMarks();
     m_actualMarkCounts.insert(nMarks);
 
@@ -157,9 +173,144 @@ DeadNonceList::evictEntries()
         return;
 
     for (ssize_t nEvict = std::min<ssize_t>(nOverCapacity, EVICT_LIMIT); nEvict > 0; --nEvict) {
-        m_queue.erase(m_queue.begin());
+        Entry entry = m_queue.front();
+        m_queue.pop_front();
+        if (entry == MARK) {
+            --m_nMarks;
+        }
+        else {
+            m_ht.erase(entry);
+        }
     }
     BOOST_ASSERT(m_queue.size() >= m_capacity);
 }
 
+DeadNonceList::Queue::Queue()
+  : m_buffer(MIN_TABLE_SIZE)
+  , m_head(0)
+  , m_size(0)
+{
+}
+
+void
+DeadNonceList::Queue::push_back(Entry entry)
+{
+    if (m_size == m_buffer.size()) {
+        this->resize(m_buffer.size() * 2);
+    }
+    m_buffer[(m_head + m_size) & (m_buffer.size() - 1)] = entry;
+    ++m_size;
+}
+
+void
+DeadNonceList::Queue::pop_front()
+{
+    BOOST_ASSERT(m_size > 0);
+    m_head = (m_head + 1) & (m_buffer.size() - 1);
+    --m_size;
+
+    // give memory back after the capacity was adjusted down
+    if (m_buffer.size() > MIN_TABLE_SIZE && m_size < m_buffer.size() / 4) {
+        this->resize(m_buffer.size() / 2);
+    }
+}
+
+void
+DeadNonceList::Queue::resize(size_t bufferSize)
+{
+    std::vector<Entry> buffer(bufferSize);
+    for (size_t i = 0; i < m_size; ++i) {
+        buffer[i] = m_buffer[(m_head + i) & (m_buffer.size() - 1)];
+    }
+    m_buffer.swap(buffer);
+    m_head = 0;
+}
+
+DeadNonceList::Hashtable::Hashtable()
+  : m_slots(MIN_TABLE_SIZE, Slot{MARK, 0})
+  , m_mask(MIN_TABLE_SIZE - 1)
+  , m_nUsed(0)
+{
+}
+
+size_t
+DeadNonceList::Hashtable::find(Entry entry) const
+{
+    // entries are well-mixed hashes, so their low bits are used directly
+    size_t i = entry & m_mask;
+    while (m_slots[i].entry != MARK && m_slots[i].entry != entry) {
+        i = (i + 1) & m_mask;
+    }
+    return i;
+}
+
+bool
+DeadNonceList::Hashtable::has(Entry entry) const
+{
+    return m_slots[this->find(entry)].entry == entry;
+}
+
+void
+DeadNonceList::Hashtable::insert(Entry entry)
+{
+    BOOST_ASSERT(entry != MARK);
+    size_t i = this->find(entry);
+    if (m_slots[i].entry == entry) {
+        ++m_slots[i].count;
+        return;
+    }
+
+    m_slots[i] = {entry, 1};
+    ++m_nUsed;
+    if (m_nUsed * 2 > m_slots.size()) {
+        this->rehash(m_slots.size() * 2);
+    }
+}
+
+void
+DeadNonceList::Hashtable::erase(Entry entry)
+{
+    size_t i = this->find(entry);
+    BOOST_ASSERT(m_slots[i].entry == entry);
+    if (--m_slots[i].count > 0) {
+        return;
+    }
+
+    // backward shift deletion: move later entries of the probe sequence into the hole
+    size_t j = i;
+    while (true) {
+        j = (j + 1) & m_mask;
+        if (m_slots[j].entry == MARK) {
+            break;
+        }
+        size_t home = m_slots[j].entry & m_mask;
+        // the entry at j may fill the hole at i only if its home is not cyclically within (i, j]
+        bool isHomeBetween = i <= j ? (i < home && home <= j) : (i < home || home <= j);
+        if (!isHomeBetween) {
+            m_slots[i] = m_slots[j];
+            i = j;
+        }
+    }
+    m_slots[i] = {MARK, 0};
+    --m_nUsed;
+
+    if (m_slots.size() > MIN_TABLE_SIZE && m_nUsed * 8 < m_slots.size()) {
+        this->rehash(m_slots.size() / 2);
+    }
+}
+
+void
+DeadNonceList::Hashtable::rehash(size_t nSlots)
+{
+    std::vector<Slot> slots(nSlots, Slot{MARK, 0});
+    slots.swap(m_slots);
+    m_mask = nSlots - 1;
+
+    for (const Slot& slot : slots) {
+        if (slot.entry != MARK) {
+            m_slots[this->find(slot.entry)] = slot;
+        }
+    }
+}
+
 } // namespace nfd
@@ -28,10 +28,6 @@
 
 #include "core/common.hpp"
 
-#include <boost/multi_index_container.hpp>
-#include <boost/multi_index/hashed_index.hpp>
-#include <boost/multi_index/sequenced_index.hpp>
-
 namespace nfd {
 
 /** \brief Represents the Dead Nonce List
@@ -44,6 +40,13 @@ namespace nfd {
  *  There could be false positives (non-looping Interest could be considered looping),
  *  but the probability is small, and the error is recoverable when consumer retransmits
  *  with a different Nonce.
+ *  The hash is derived from the NameTree hashes of all prefixes of the Name, taken in order,
+ *  because the NameTree hash of a single prefix does not depend on the component order.
+ *  These hashes are memoized on the Name, so the PIT lookup of the same Interest does not
+ *  hash the Name again.
+ *
+ *  Entries are kept in insertion order in a ring buffer, and indexed by an open-addressing
+ *  hashtable that counts the occurrences of every hash.
  *
  *  To reduce memory usage, entries do not have associated timestamps. Instead,
  *  lifetime of entries is controlled by dynamically adjusting the capacity of the container.
@@ -89,15 +92,73 @@ class DeadNonceList : noncopyable {
   private: // Entry and Index
     typedef uint64_t Entry;
 
+    /** \return hash of name+nonce, never equal to MARK
+     */
     static Entry makeEntry(const Name& name, uint32_t nonce);
 
-    typedef boost::multi_index_container<
-      Entry, boost::multi_index::indexed_by<boost::multi_index::sequenced<>,
-                                            boost::multi_index::hashed_non_unique<boost::multi_index::identity<Entry>>>>
-      Index;
+    /** \brief Entries and MARKs in insertion order, stored in a ring buffer
+     */
+    class Queue {
+      public:
+        Queue();
+
+        size_t
+        size() const
+        {
+            return m_size;
+        }
+
+        Entry
+        front() const
+        {
+            return m_buffer[m_head];
+        }
+
+        void push_back(Entry entry);
+
+        void pop_front();
+
+      private:
+        void resize(size_t bufferSize);
+
+      private:
+        std::vector<Entry> m_buffer; // size is a power of 2
+        size_t m_head;
+        size_t m_size;
+    };
+
+    /** \brief Multiset of entries, as a hashtable with open addressing and linear probing
+     *
+     *  A slot whose entry equals MARK is empty; MARKs are not indexed.
+     */
+    class Hashtable {
+      public:
+        Hashtable();
+
+        bool has(Entry entry) const;
+
+        void insert(Entry entry);
+
+        /** \brief Remove one occurrence of \p entry
+         *  \pre has(entry)
+         */
+        void erase(Entry entry);
+
+      private:
+        struct Slot {
+            Entry entry;
+            size_t count;
+        };
+
+        size_t find(Entry entry) const;
+
+        void rehash(size_t nSlots);
 
-    typedef Index::nth_index<0>::type Queue;
-    typedef Index::nth_index<1>::type Hashtable;
+      private:
+        std::vector<Slot> m_slots; // size is a power of 2
+        size_t m_mask;
+        size_t m_nUsed;
+    };
 
   private: // actual lifetime estimation and capacity control
     /** \brief Return the number of MARKs in the index
@@ -127,9 +188,9 @@ class DeadNonceList : noncopyable {
 
   private:
     time::nanoseconds m_lifetime;
-    Index m_index;
-    Queue& m_queue;
-    Hashtable& m_ht;
+    Queue m_queue;
+    Hashtable m_ht;
+    size_t m_nMarks; ///< number of MARKs in m_queue
 
     PUBLIC_WITH_TESTS_ELSE_PRIVATE : // actual lifetime estimation and capacity control
 
@@ -50,7 +50,7 @@ Measurements::get(name_tree::Entry& nte)
     entry = nte.getMeasurementsEntry();
 
     entry->m_expiry = time::steady_clock::now() + getInitialLifetime();
-    entry->m_cleanup = getScheduler().schedule(getInitialLifetime(), [=] { cleanup(*entry); });
+    entry->m_cleanup = getScheduler().schedule(getInitialLifetime(), [this, entry] { cleanup(*entry); });
 
     return *entry;
 }
@@ -133,14 +133,20 @@ Measurements::extendLifetime(Entry& entry, const time::nanoseconds& lifetime)
         return;
     }
 
-    entry.m_cleanup.cancel();
+    // the pending cleanup event notices the later expiry and reschedules itself,
+    // so that strategies extending the lifetime on every packet cost no scheduler operation
     entry.m_expiry = expiry;
-    entry.m_cleanup = getScheduler().schedule(lifetime, [&] { cleanup(entry); });
 }
 
 void
 Measurements::cleanup(Entry& entry)
 {
+    auto now = time::steady_clock::now();
+    if (entry.m_expiry > now) {
+        entry.m_cleanup = getScheduler().schedule(entry.m_expiry - now, [this, &entry] { cleanup(entry); });
+        return;
+    }
+
     name_tree::Entry* nte = m_nameTree.getEntry(entry);
     BOOST_ASSERT(nte != nullptr);
 
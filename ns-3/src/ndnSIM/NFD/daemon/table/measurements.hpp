@@ -128,6 +128,8 @@ class Measurements : noncopyable {
     /** \brief Extend lifetime of an entry
      *
      *  The entry will be kept until at least now()+lifetime.
+     *  Only the expiry time is updated; the cleanup event scheduled for the previous expiry
+     *  reschedules itself when it fires, so this does not touch the scheduler.
      */
     void extendLifetime(Entry& entry, const time::nanoseconds& lifetime);
 
@@ -138,6 +140,8 @@ class Measurements : noncopyable {
     }
 
   private:
+    /** \brief Erase \p entry if it has expired, otherwise schedule the next check at its expiry
+     */
     void cleanup(Entry& entry);
 
     Entry& get(name_tree::Entry& nte);
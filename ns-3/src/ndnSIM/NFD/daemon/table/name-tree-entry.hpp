@@ -142,6 +142,27 @@ class Entry : noncopyable {
 
     void setStrategyChoiceEntry(unique_ptr<strategy_choice::Entry> strategyChoiceEntry);
 
+  public: // effective strategy cache
+    /** \return effective strategy cached by StrategyChoice, or nullptr if the cache is not from
+     *          \p generation of StrategyChoice
+     *  \note This function is for StrategyChoice internal use.
+     */
+    fw::Strategy*
+    getCachedStrategy(uint64_t generation) const
+    {
+        return m_cachedStrategyGeneration == generation ? m_cachedStrategy : nullptr;
+    }
+
+    /** \brief cache the effective strategy found in \p generation of StrategyChoice
+     *  \note This function is for StrategyChoice internal use.
+     */
+    void
+    setCachedStrategy(fw::Strategy* strategy, uint64_t generation) const
+    {
+        m_cachedStrategy = strategy;
+        m_cachedStrategyGeneration = generation;
+    }
+
     /** \return name tree entry on which a table entry is attached,
      *          or nullptr if the table entry is detached
      *  \note This function is for NameTree internal use. Other components
@@ -165,6 +186,9 @@ class Entry : noncopyable {
     unique_ptr<measurements::Entry> m_measurementsEntry;
     unique_ptr<strategy_choice::Entry> m_strategyChoiceEntry;
 
+    mutable fw::Strategy* m_cachedStrategy = nullptr;
+    mutable uint64_t m_cachedStrategyGeneration = 0;
+
     friend Node* getNode(const Entry& entry);
 };
 
@@ -57,34 +57,52 @@ using HashFunc = std::conditional<(sizeof(HashValue) > 4), Hash64, Hash32>::type
 HashValue
 computeHash(const Name& name, size_t prefixLen)
 {
+    size_t last = std::min(prefixLen, name.size());
+    const HashSequence* memo = name.getPrefixHashes();
+    if (memo != nullptr && memo->size() > last) {
+        return (*memo)[last];
+    }
+
     name.wireEncode(); // ensure wire buffer exists
 
     HashValue h = 0;
-    for (size_t i = 0, last = std::min(prefixLen, name.size()); i < last; ++i) {
+    for (size_t i = 0; i < last; ++i) {
         const name::Component& comp = name[i];
         h ^= HashFunc::compute(comp.wire(), comp.size());
     }
     return h;
 }
 
-HashSequence
+const HashSequence&
 computeHashes(const Name& name, size_t prefixLen)
 {
+    size_t last = std::min(prefixLen, name.size());
+    const HashSequence* memo = name.getPrefixHashes();
+    if (memo != nullptr && memo->size() > last) {
+        return *memo;
+    }
+
     name.wireEncode(); // ensure wire buffer exists
 
-    size_t last = std::min(prefixLen, name.size());
+    // 已经缓存的较短前缀直接沿用, 只计算剩下的分量
     HashSequence seq;
     seq.reserve(last + 1);
+    if (memo != nullptr) {
+        seq = *memo;
+    }
+    else {
+        seq.push_back(0);
+    }
 
-    HashValue h = 0;
-    seq.push_back(h);
-
-    for (size_t i = 0; i < last; ++i) {
+    HashValue h = seq.back();
+    for (size_t i = seq.size() - 1; i < last; ++i) {
         const name::Component& comp = name[i];
         h ^= HashFunc::compute(comp.wire(), comp.size());
         seq.push_back(h);
     }
-    return seq;
+
+    name.setPrefixHashes(std::move(seq));
+    return *name.getPrefixHashes();
 }
 
 Node::Node(HashValue h, const Name& name)
@@ -218,6 +236,25 @@ Hashtable::find(const Name& name, size_t prefixLen, const HashSequence& hashes)
     return const_cast<Hashtable*>(this)->findOrInsert(name, prefixLen, hashes[prefixLen], false).first;
 }
 
+void
+Hashtable::prefetchBucket(HashValue h) const
+{
+#if defined(__GNUC__)
+    __builtin_prefetch(&m_buckets[this->computeBucketIndex(h)]);
+#endif
+}
+
+void
+Hashtable::prefetchNode(HashValue h) const
+{
+#if defined(__GNUC__)
+    const Node* node = m_buckets[this->computeBucketIndex(h)];
+    if (node != nullptr) {
+        __builtin_prefetch(node);
+    }
+#endif
+}
+
 std::pair<const Node*, bool>
 Hashtable::insert(const Name& name, size_t prefixLen, const HashSequence& hashes)
 {
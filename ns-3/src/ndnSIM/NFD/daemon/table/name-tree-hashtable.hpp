@@ -40,16 +40,24 @@ using HashValue = size_t;
 /** \brief a sequence of hash values
  *  \sa computeHashes
  */
-using HashSequence = std::vector<HashValue>;
+using HashSequence = Name::PrefixHashes;
+
+static_assert(std::is_same<HashSequence::value_type, HashValue>::value,
+              "Name::PrefixHashes must be able to hold HashValue");
 
 /** \brief computes hash value of \p name.getPrefix(prefixLen)
  */
 HashValue computeHash(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
 /** \brief computes hash values for each prefix of \p name.getPrefix(prefixLen)
- *  \return a hash sequence, where the i-th hash value equals computeHash(name, i)
+ *  \return a hash sequence, where the i-th hash value equals computeHash(name, i);
+ *          it may contain more than prefixLen+1 elements
+ *
+ *  The sequence is memoized on \p name, so that the PIT, FIB, StrategyChoice and Measurements
+ *  lookups of the same packet name hash its components only once.
+ *  The returned reference is valid until \p name is modified or destroyed.
  */
-HashSequence computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
+const HashSequence& computeHashes(const Name& name, size_t prefixLen = std::numeric_limits<size_t>::max());
 
 /** \brief a hashtable node
  *
@@ -195,6 +203,15 @@ class Hashtable {
      */
     const Node* find(const Name& name, size_t prefixLen, const HashSequence& hashes) const;
 
+    /** \brief prefetch the bucket for hash value h into CPU cache
+     */
+    void prefetchBucket(HashValue h) const;
+
+    /** \brief prefetch the first node in the bucket for hash value h into CPU cache
+     *  \note The bucket should have been prefetched by prefetchBucket(h) some time before.
+     */
+    void prefetchNode(HashValue h) const;
+
     /** \brief find or insert node for name.getPrefix(prefixLen)
      *  \pre name.size() > prefixLen
      *  \pre hashes == computeHashes(name)
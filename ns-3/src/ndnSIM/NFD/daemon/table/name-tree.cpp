@@ -47,7 +47,7 @@ NameTree::lookup(const Name& name, size_t prefixLen)
     BOOST_ASSERT(prefixLen <= name.size());
     BOOST_ASSERT(prefixLen <= getMaxDepth());
 
-    HashSequence hashes = computeHashes(name, prefixLen);
+    const HashSequence& hashes = computeHashes(name, prefixLen);
     const Node* node = nullptr;
     Entry* parent = nullptr;
 
@@ -145,6 +145,20 @@ NameTree::eraseIfEmpty(Entry* entry, bool canEraseAncestors)
     return nErased;
 }
 
+void
+NameTree::prefetch(const std::vector<const Name*>& names) const
+{
+    // 先预取所有名字的桶, 再预取桶中的第一个节点, 两轮之间的 cache miss 相互重叠
+    for (const Name* name : names) {
+        size_t depth = std::min(name->size(), getMaxDepth());
+        m_ht.prefetchBucket(computeHashes(*name, depth)[depth]);
+    }
+    for (const Name* name : names) {
+        size_t depth = std::min(name->size(), getMaxDepth());
+        m_ht.prefetchNode(computeHashes(*name, depth)[depth]);
+    }
+}
+
 Entry*
 NameTree::findExactMatch(const Name& name, size_t prefixLen) const
 {
@@ -161,7 +175,7 @@ Entry*
 NameTree::findLongestPrefixMatch(const Name& name, const EntrySelector& entrySelector) const
 {
     size_t depth = std::min(name.size(), getMaxDepth());
-    HashSequence hashes = computeHashes(name, depth);
+    const HashSequence& hashes = computeHashes(name, depth);
 
     for (ssize_t i = depth; i >= 0; --i) {
         const Node* node = m_ht.find(name, i, hashes);
@@ -29,6 +29,8 @@
 #include "pit-in-record.hpp"
 #include "pit-out-record.hpp"
 
+#include <ndn-cxx/util/pool-allocator.hpp>
+
 #include <list>
 
 namespace nfd {
@@ -39,13 +41,16 @@ class Entry;
 
 namespace pit {
 
+using ndn::util::PoolAllocator;
+
 /** \brief An unordered collection of in-records
+ *  \note Nodes come from a PoolAllocator, so that records of finalized entries are reused.
  */
-typedef std::list<InRecord> InRecordCollection;
+typedef std::list<InRecord, PoolAllocator<InRecord>> InRecordCollection;
 
 /** \brief An unordered collection of out-records
  */
-typedef std::list<OutRecord> OutRecordCollection;
+typedef std::list<OutRecord, PoolAllocator<OutRecord>> OutRecordCollection;
 
 /** \brief An Interest table entry
  *
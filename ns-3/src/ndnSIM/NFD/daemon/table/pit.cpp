@@ -75,7 +75,8 @@ Pit::findOrInsert(const Interest& interest, bool allowInsert)
         return {nullptr, true};
     }
 
-    auto entry = make_shared<Entry>(interest);
+    // 表项和 shared_ptr 控制块一起从内存池分配, 表项被删除后内存留给下一个 Interest
+    auto entry = std::allocate_shared<Entry>(PoolAllocator<Entry>(), interest);
     nte->insertPitEntry(entry);
     ++m_nItems;
     return {entry, true};
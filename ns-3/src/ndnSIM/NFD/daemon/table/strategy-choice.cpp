@@ -65,6 +65,7 @@ StrategyChoice::setDefaultStrategy(const Name& strategyName)
     name_tree::Entry& nte = m_nameTree.lookup(Name());
     nte.setStrategyChoiceEntry(std::move(entry));
     ++m_nItems;
+    ++m_generation;
 }
 
 StrategyChoice::InsertResult
@@ -111,6 +112,7 @@ StrategyChoice::insert(const Name& prefix, const Name& strategyName)
 
     this->changeStrategy(*entry, *oldStrategy, *strategy);
     entry->setStrategy(std::move(strategy));
+    ++m_generation;
     return InsertResult::OK;
 }
 
@@ -159,6 +161,7 @@ StrategyChoice::erase(const Name& prefix)
     nte->setStrategyChoiceEntry(nullptr);
     m_nameTree.eraseIfEmpty(nte);
     --m_nItems;
+    ++m_generation;
 }
 
 std::pair<bool, Name>
@@ -177,31 +180,59 @@ StrategyChoice::get(const Name& prefix) const
     return {true, entry->getStrategyInstanceName()};
 }
 
-template <typename K>
 Strategy&
-StrategyChoice::findEffectiveStrategyImpl(const K& key) const
+StrategyChoice::findEffectiveStrategyImpl(const name_tree::Entry& nte) const
 {
-    const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(key, &nteHasStrategyChoiceEntry);
-    BOOST_ASSERT(nte != nullptr);
-    return nte->getStrategyChoiceEntry()->getStrategy();
+    // 向上查找到有 StrategyChoice 条目或有效缓存的祖先
+    const name_tree::Entry* match = &nte;
+    Strategy* strategy = nullptr;
+    while (true) {
+        if (match->getStrategyChoiceEntry() != nullptr) {
+            strategy = &match->getStrategyChoiceEntry()->getStrategy();
+            break;
+        }
+        strategy = match->getCachedStrategy(m_generation);
+        if (strategy != nullptr) {
+            break;
+        }
+        match = match->getParent();
+        BOOST_ASSERT(match != nullptr);
+    }
+
+    // 缓存到经过的条目上, 之后同一前缀下的查找在这些条目处结束
+    for (const name_tree::Entry* passed = &nte; passed != match; passed = passed->getParent()) {
+        passed->setCachedStrategy(strategy, m_generation);
+    }
+    return *strategy;
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const Name& prefix) const
 {
-    return this->findEffectiveStrategyImpl(prefix);
+    // StrategyChoice 条目都有 NameTree 条目, 所以从 prefix 最长的已有前缀开始查找即可
+    const name_tree::Entry* nte = m_nameTree.findLongestPrefixMatch(prefix);
+    BOOST_ASSERT(nte != nullptr);
+    return this->findEffectiveStrategyImpl(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const pit::Entry& pitEntry) const
 {
-    return this->findEffectiveStrategyImpl(pitEntry);
+    const name_tree::Entry* nte = m_nameTree.getEntry(pitEntry);
+    BOOST_ASSERT(nte != nullptr);
+    if (nte->getName().size() < pitEntry.getName().size()) {
+        // PIT entry name either exceeds depth limit or ends with an implicit digest
+        return this->findEffectiveStrategy(pitEntry.getName());
+    }
+    return this->findEffectiveStrategyImpl(*nte);
 }
 
 Strategy&
 StrategyChoice::findEffectiveStrategy(const measurements::Entry& measurementsEntry) const
 {
-    return this->findEffectiveStrategyImpl(measurementsEntry);
+    const name_tree::Entry* nte = m_nameTree.getEntry(measurementsEntry);
+    BOOST_ASSERT(nte != nullptr);
+    return this->findEffectiveStrategyImpl(*nte);
 }
 
 static inline void
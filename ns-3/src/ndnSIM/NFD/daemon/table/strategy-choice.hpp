@@ -125,6 +125,9 @@ class StrategyChoice : noncopyable {
 
   public: // effective strategy
     /** \brief Get effective strategy for \p prefix
+     *
+     *  The effective strategy is cached on the NameTree entries visited by the lookup.
+     *  The cache is invalidated by every change to StrategyChoice, so it does not change the result.
      */
     fw::Strategy& findEffectiveStrategy(const Name& prefix) const;
 
@@ -167,10 +170,12 @@ class StrategyChoice : noncopyable {
   private:
     void changeStrategy(Entry& entry, fw::Strategy& oldStrategy, fw::Strategy& newStrategy);
 
-    /** \tparam K a parameter acceptable to NameTree::findLongestPrefixMatch
+    /** \brief Get effective strategy for the name of \p nte
+     *
+     *  Walks up from \p nte until an entry with a StrategyChoice entry or a valid cached
+     *  strategy, and caches the result on the entries passed by.
      */
-    template <typename K>
-    fw::Strategy& findEffectiveStrategyImpl(const K& key) const;
+    fw::Strategy& findEffectiveStrategyImpl(const name_tree::Entry& nte) const;
 
     Range getRange() const;
 
@@ -178,6 +183,9 @@ class StrategyChoice : noncopyable {
     Forwarder& m_forwarder;
     NameTree& m_nameTree;
     size_t m_nItems = 0;
+
+    /// incremented whenever an effective strategy may change, invalidating the NameTree caches
+    uint64_t m_generation = 1;
 };
 
 std::ostream& operator<<(std::ostream& os, const StrategyChoice::InsertResult& res);
@@ -232,12 +232,7 @@ Consumer::OnData(shared_ptr<const Data> data)
     } // 如果它是null呢? 什么时候会是null? 上面说了,从本节点缓存响应
     NS_LOG_DEBUG("Hop count: " << hopCount);
 
-	int chaoTag = 0;
-	auto chaochaoTag = data->getTag<lp::ChaoChaoTag>(); // tag 直接拿出来是一个指针才对！
-	if (chaochaoTag != nullptr) {
-		chaoTag = *chaochaoTag;
-	}
-	NS_LOG_DEBUG("chaochao TAG: " << chaoTag);
+	NS_LOG_DEBUG("chaochao TAG: " << data->getCacheDecisionState());
 
     SeqTimeoutsContainer::iterator entry = m_seqLastDelay.find(seq);
     if (entry != m_seqLastDelay.end()) {
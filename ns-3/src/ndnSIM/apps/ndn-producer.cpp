@@ -26,6 +26,9 @@
 
 #include "helper/ndn-fib-helper.hpp"
 #include "model/ndn-l3-protocol.hpp"
+#include "utils/ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/zero-buffer.hpp>
 
 #include <memory>
 
@@ -53,13 +56,16 @@ Producer::GetTypeId(void)
         .AddAttribute("Postfix", "Postfix that is added to the output data (e.g., for adding producer-uniqueness)",
                       StringValue("/"), MakeNameAccessor(&Producer::m_postfix), MakeNameChecker())
         .AddAttribute("PayloadSize", "Virtual payload size for Content packets", UintegerValue(1024),
-                      MakeUintegerAccessor(&Producer::m_virtualPayloadSize), MakeUintegerChecker<uint32_t>())
+                      MakeUintegerAccessor(&Producer::SetPayloadSize, &Producer::GetPayloadSize),
+                      MakeUintegerChecker<uint32_t>())
         .AddAttribute("Freshness", "Freshness of data packets, if 0, then unlimited freshness", TimeValue(Seconds(0)),
-                      MakeTimeAccessor(&Producer::m_freshness), MakeTimeChecker())
+                      MakeTimeAccessor(&Producer::SetFreshness, &Producer::GetFreshness), MakeTimeChecker())
         .AddAttribute("Signature", "Fake signature, 0 valid signature (default), other values application-specific",
-                      UintegerValue(0), MakeUintegerAccessor(&Producer::m_signature), MakeUintegerChecker<uint32_t>())
+                      UintegerValue(0), MakeUintegerAccessor(&Producer::SetSignature, &Producer::GetSignature),
+                      MakeUintegerChecker<uint32_t>())
         .AddAttribute("KeyLocator", "Name to be used for key locator.  If root, then key locator is not used",
-                      NameValue(), MakeNameAccessor(&Producer::m_keyLocator), MakeNameChecker());
+                      NameValue(), MakeNameAccessor(&Producer::SetKeyLocator, &Producer::GetKeyLocator),
+                      MakeNameChecker());
     return tid;
 }
 
@@ -68,6 +74,8 @@ Producer::Producer()
     NS_LOG_FUNCTION_NOARGS();
 }
 
+Producer::~Producer() = default;
+
 // inherited from Application base class.
 void
 Producer::StartApplication()
@@ -96,15 +104,28 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
     if (!m_active)
         return;
 
-    Name dataName(interest->getName());
-    // dataName.append(m_postfix);
-    // dataName.appendVersion();
+    if (m_dataTemplate == nullptr) {
+        m_dataTemplate = make_unique<DataTemplate>(*MakeDataPrototype());
+    }
+
+    // 模板里已经编码好了除 Name 以外的所有字段, 这里只需要把 Name 拼到前面
+    auto data = m_dataTemplate->makeData(interest->getName());
+
+    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
+
+	 // just callback
+    m_transmittedDatas(data, this, m_face);
+    m_appLink->onReceiveData(*data);
+}
 
+shared_ptr<Data>
+Producer::MakeDataPrototype() const
+{
     auto data = make_shared<Data>();
-    data->setName(dataName);
     data->setFreshnessPeriod(::ndn::time::milliseconds(m_freshness.GetMilliSeconds()));
 
-    data->setContent(make_shared<::ndn::Buffer>(m_virtualPayloadSize));
+    // 虚拟负载: 所有同样大小的 Data 共享一块只读的全零 buffer
+    data->setContent(::ndn::getZeroBuffer(m_virtualPayloadSize));
 
     Signature signature;
     SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
@@ -117,14 +138,59 @@ Producer::OnInterest(shared_ptr<const Interest> interest)
     signature.setValue(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, m_signature));
 
     data->setSignature(signature);
+    return data;
+}
 
-    NS_LOG_INFO("node(" << GetNode()->GetId() << ") responding with Data: " << data->getName());
+void
+Producer::SetPayloadSize(uint32_t payloadSize)
+{
+    m_virtualPayloadSize = payloadSize;
+    m_dataTemplate.reset();
+}
 
-    // to create real wire encoding
-    data->wireEncode();
-	 // just callback
-    m_transmittedDatas(data, this, m_face);
-    m_appLink->onReceiveData(*data);
+uint32_t
+Producer::GetPayloadSize() const
+{
+    return m_virtualPayloadSize;
+}
+
+void
+Producer::SetFreshness(Time freshness)
+{
+    m_freshness = freshness;
+    m_dataTemplate.reset();
+}
+
+Time
+Producer::GetFreshness() const
+{
+    return m_freshness;
+}
+
+void
+Producer::SetSignature(uint32_t signature)
+{
+    m_signature = signature;
+    m_dataTemplate.reset();
+}
+
+uint32_t
+Producer::GetSignature() const
+{
+    return m_signature;
+}
+
+void
+Producer::SetKeyLocator(Name keyLocator)
+{
+    m_keyLocator = keyLocator;
+    m_dataTemplate.reset();
+}
+
+Name
+Producer::GetKeyLocator() const
+{
+    return m_keyLocator;
 }
 
 } // namespace ndn
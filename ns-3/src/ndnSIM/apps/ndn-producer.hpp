@@ -31,6 +31,8 @@
 namespace ns3 {
 namespace ndn {
 
+class DataTemplate;
+
 /**
  * @ingroup ndn-apps
  * @brief A simple Interest-sink applia simple Interest-sink application
@@ -47,6 +49,8 @@ class Producer : public App {
 
     Producer();
 
+    ~Producer();
+
     // inherited from NdnApp
     // 收到interest包后，装载一个data包（内部有编码为block的成员），最后把任务交接给到m_appLink->onReceiveData
     // NOTE: 这是应用层收包
@@ -60,6 +64,38 @@ class Producer : public App {
     // m_active = false并关闭m_face
     virtual void StopApplication(); // Called at time specified by Stop
 
+  private:
+    /**
+     * @brief Build a signed Data packet without name from the current attribute values
+     */
+    shared_ptr<Data>
+    MakeDataPrototype() const;
+
+    // 修改这些属性会使 Data 模板失效, 下一个 Interest 到来时重新生成
+    void
+    SetPayloadSize(uint32_t payloadSize);
+
+    uint32_t
+    GetPayloadSize() const;
+
+    void
+    SetFreshness(Time freshness);
+
+    Time
+    GetFreshness() const;
+
+    void
+    SetSignature(uint32_t signature);
+
+    uint32_t
+    GetSignature() const;
+
+    void
+    SetKeyLocator(Name keyLocator);
+
+    Name
+    GetKeyLocator() const;
+
   private:
     Name m_prefix;                 // 前缀
     Name m_postfix;                // 后缀???
@@ -68,6 +104,8 @@ class Producer : public App {
 
     uint32_t m_signature;
     Name m_keyLocator;
+
+    std::unique_ptr<DataTemplate> m_dataTemplate; // 除 Name 外预先编码好的 Data
 };
 
 } // namespace ndn
@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <fstream>
+#include <iostream>
+
+namespace ns3 {
+
+/**
+ * Converts a trace written with ndn::TraceFormat::Binary (e.g., by
+ * ndn::L3RateTracer::InstallAll("rate-trace.bin.gz", Seconds(0.5), ndn::TraceFormat::Binary))
+ * into the tab-separated text the tracer writes in ndn::TraceFormat::Text:
+ *
+ *     ./waf --run="ndn-trace-convert --input=rate-trace.bin.gz --output=rate-trace.txt"
+ *
+ * Input files with ".gz" suffix are decompressed on the fly.  If output is "-", text is written
+ * to the standard output.
+ */
+
+int
+main(int argc, char* argv[])
+{
+    std::string input;
+    std::string output = "-";
+
+    CommandLine cmd;
+    cmd.AddValue("input", "Binary trace file", input);
+    cmd.AddValue("output", "Text trace file, - for standard output", output);
+    cmd.Parse(argc, argv);
+
+    if (input.empty()) {
+        std::cerr << "--input is required" << std::endl;
+        return 2;
+    }
+
+    std::ifstream inputFile(input, std::ios_base::in | std::ios_base::binary);
+    if (!inputFile.is_open()) {
+        std::cerr << "Cannot open " << input << std::endl;
+        return 1;
+    }
+
+    namespace io = boost::iostreams;
+    io::filtering_istream is;
+    if (boost::algorithm::ends_with(input, ".gz")) {
+        is.push(io::gzip_decompressor());
+    }
+    is.push(inputFile);
+
+    std::ofstream file;
+    std::ostream* os = &std::cout;
+    if (output != "-") {
+        file.open(output, std::ios_base::out | std::ios_base::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Cannot open " << output << std::endl;
+            return 1;
+        }
+        os = &file;
+    }
+
+    try {
+        ndn::BinaryTraceReader reader(is);
+        reader.writeTsv(*os);
+    }
+    catch (const std::exception& e) {
+        std::cerr << input << ": " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
+
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    return ns3::main(argc, argv);
+}
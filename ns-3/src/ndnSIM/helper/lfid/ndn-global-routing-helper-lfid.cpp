@@ -177,6 +177,7 @@ GlobalRoutingHelper::CalculateLfidRoutes()
     for (const auto& nodeEntry : allNodeFIB) {
         int nodeId = nodeEntry.first;
         const auto& fib = nodeEntry.second;
+        std::vector<FibHelper::Route> routes;
 
         // For each destination:
         for (const auto& dst : fib) {
@@ -189,11 +190,12 @@ GlobalRoutingHelper::CalculateLfidRoutes()
                 int neighborTotalCost = nh.getCost();
 
                 for (const auto& prefix : dstRouter->GetLocalPrefixes()) {
-                    Ptr<Node> node = NodeList::GetNode(static_cast<uint32_t>(nodeId));
-                    FibHelper::AddRoute(node, *prefix, faceMap.at(nodeId).at(neighborId), neighborTotalCost);
+                    routes.push_back({*prefix, faceMap.at(nodeId).at(neighborId), neighborTotalCost});
                 }
             }
         }
+
+        InstallRoutes(NodeList::GetNode(static_cast<uint32_t>(nodeId)), routes);
     }
 }
 
@@ -39,6 +39,8 @@
 #include "ns3/data-rate.h"
 
 #include "daemon/mgmt/fib-manager.hpp"
+#include "daemon/rib/service.hpp"
+#include "daemon/fw/forwarder.hpp"
 #include "ns3/ndnSIM/model/ndn-l3-protocol.hpp"
 #include "ns3/ndnSIM/helper/ndn-stack-helper.hpp"
 
@@ -50,6 +52,24 @@ NS_LOG_COMPONENT_DEFINE("ndn.FibHelper");
 void
 FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+    if (l3protocol->isDataPlaneOnly()) {
+        // no FibManager on the node: apply the command to the FIB directly
+        nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+        NS_ASSERT_MSG(face != nullptr, "Face with ID [" << parameters.getFaceId() << "] does not exist on node ["
+                                                        << node->GetId() << "]");
+        if (parameters.getName().size() > nfd::Fib::getMaxDepth()) {
+            NS_LOG_WARN("FIB entry prefix " << parameters.getName() << " cannot exceed " << nfd::Fib::getMaxDepth()
+                                            << " components, ignoring");
+            return;
+        }
+
+        nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+        fib.addOrUpdateNextHop(*fib.insert(parameters.getName()).first, *face,
+                               parameters.hasCost() ? parameters.getCost() : 0);
+        return;
+    }
+
     Block encodedParameters(parameters.wireEncode());
 
     Name commandName("/localhost/nfd/fib");
@@ -60,13 +80,24 @@ FibHelper::AddNextHop(const ControlParameters& parameters, Ptr<Node> node)
     command->setCanBePrefix(false);
     StackHelper::getKeyChain().sign(*command);
 
-    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
     l3protocol->injectInterest(*command);
 }
 
 void
 FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
 {
+    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+    if (l3protocol->isDataPlaneOnly()) {
+        nfd::Face* face = l3protocol->getFaceTable().get(parameters.getFaceId());
+        nfd::Fib& fib = l3protocol->getForwarder()->getFib();
+        nfd::fib::Entry* entry = fib.findExactMatch(parameters.getName());
+        if (face != nullptr && entry != nullptr) {
+            // the entry is erased together with its last next hop
+            fib.removeNextHop(*entry, *face);
+        }
+        return;
+    }
+
     Block encodedParameters(parameters.wireEncode());
 
     Name commandName("/localhost/nfd/fib");
@@ -77,7 +108,6 @@ FibHelper::RemoveNextHop(const ControlParameters& parameters, Ptr<Node> node)
     command->setCanBePrefix(false);
     StackHelper::getKeyChain().sign(*command);
 
-    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
     l3protocol->injectInterest(*command);
 }
 
@@ -163,6 +193,44 @@ FibHelper::AddRoute(const std::string& nodeName, const Name& prefix, const std::
     AddRoute(node, prefix, otherNode, metric);
 }
 
+void
+FibHelper::AddRoutes(Ptr<Node> node, const std::vector<Route>& routes, bool updateRib)
+{
+    Ptr<L3Protocol> ndn = node->GetObject<L3Protocol>();
+    NS_ASSERT_MSG(ndn != 0, "Ndn stack should be installed on the node");
+
+    nfd::Fib& fib = ndn->getForwarder()->getFib();
+    nfd::fib::Entry* entry = nullptr;
+
+    for (const auto& route : routes) {
+        NS_LOG_LOGIC("[" << node->GetId() << "]$ route add " << route.prefix << " via " << route.face->getLocalUri()
+                         << " metric " << route.metric << " (direct)");
+        NS_ASSERT_MSG(ndn->getFaceTable().get(route.face->getId()) == route.face.get(),
+                      "Face with ID [" << route.face->getId() << "] does not exist on node [" << node->GetId() << "]");
+
+        if (route.prefix.size() > nfd::Fib::getMaxDepth()) {
+            NS_LOG_WARN("FIB entry prefix " << route.prefix << " cannot exceed " << nfd::Fib::getMaxDepth()
+                                            << " components, ignoring");
+            continue;
+        }
+
+        // consecutive routes for the same prefix (e.g., several next hops) share one lookup
+        if (entry == nullptr || entry->getPrefix() != route.prefix) {
+            entry = fib.insert(route.prefix).first;
+        }
+        fib.addOrUpdateNextHop(*entry, *route.face, route.metric);
+
+        if (updateRib && !ndn->isDataPlaneOnly()) {
+            nfd::rib::Route ribRoute;
+            ribRoute.faceId = route.face->getId();
+            ribRoute.origin = ::ndn::nfd::ROUTE_ORIGIN_STATIC;
+            ribRoute.cost = route.metric;
+            ribRoute.flags = ::ndn::nfd::ROUTE_FLAG_CHILD_INHERIT;
+            ndn->getRibService().getRib().insert(route.prefix, ribRoute);
+        }
+    }
+}
+
 void
 FibHelper::RemoveRoute(Ptr<Node> node, const Name& prefix, shared_ptr<Face> face)
 {
@@ -28,6 +28,8 @@
 
 #include <ndn-cxx/mgmt/nfd/control-parameters.hpp>
 
+#include <vector>
+
 namespace ns3 {
 namespace ndn {
 
@@ -43,6 +45,15 @@ using ::ndn::nfd::ControlParameters;
  */
 class FibHelper {
   public:
+    /**
+     * \brief Forwarding entry to be installed with AddRoutes
+     */
+    struct Route {
+        Name prefix;
+        shared_ptr<Face> face;
+        int32_t metric;
+    };
+
     /**
      * \brief Add forwarding entry to FIB
      *
@@ -95,6 +106,24 @@ class FibHelper {
     static void
     AddRoute(const std::string& nodeName, const Name& prefix, const std::string& otherNodeName, int32_t metric);
 
+    /**
+     * \brief Add a batch of forwarding entries directly to the FIB of a node
+     *
+     * Unlike AddRoute, which signs a command Interest and dispatches it to the FIB manager of
+     * the node, this method writes the nfd::Fib entries directly, with the same checks that
+     * the FIB manager performs.  It is intended for route calculation helpers that install
+     * many routes at setup time.
+     *
+     * Note that routes installed by AddRoute are not recorded in the RIB either.  If
+     * \p updateRib is true, each route is additionally recorded in the RIB of the node
+     * (origin static, CHILD_INHERIT), without triggering any RIB-to-FIB updates.
+     *
+     * \param node      Node
+     * \param routes    Forwarding entries, installed in the given order
+     * \param updateRib Whether to also record the routes in the RIB
+     */
+    static void AddRoutes(Ptr<Node> node, const std::vector<Route>& routes, bool updateRib = false);
+
     /**
      * \brief remove forwarding entry in FIB
      *
@@ -0,0 +1,156 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-global-routing-graph.hpp"
+
+#include "ns3/channel.h"
+#include "ns3/channel-list.h"
+#include "ns3/node.h"
+#include "ns3/node-list.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <unordered_map>
+
+namespace ns3 {
+namespace ndn {
+
+constexpr uint32_t GlobalRoutingGraph::NO_FACE;
+constexpr uint32_t GlobalRoutingGraph::COST_INFINITY;
+constexpr uint32_t GlobalRoutingGraph::COST_DISABLED;
+
+GlobalRoutingGraph::GlobalRoutingGraph()
+{
+    // same vertex order as boost::NdnGlobalRouterGraph
+    for (auto node = NodeList::Begin(); node != NodeList::End(); node++) {
+        Ptr<GlobalRouter> gr = (*node)->GetObject<GlobalRouter>();
+        if (gr != nullptr) {
+            m_sources.push_back(m_routers.size());
+            m_routers.push_back(gr);
+        }
+    }
+    for (auto channel = ChannelList::Begin(); channel != ChannelList::End(); channel++) {
+        Ptr<GlobalRouter> gr = (*channel)->GetObject<GlobalRouter>();
+        if (gr != nullptr) {
+            m_routers.push_back(gr);
+        }
+    }
+
+    std::unordered_map<const GlobalRouter*, uint32_t> vertexIds;
+    for (uint32_t v = 0; v < m_routers.size(); ++v) {
+        vertexIds.emplace(PeekPointer(m_routers[v]), v);
+    }
+
+    std::unordered_map<const Face*, uint32_t> faceIds;
+    m_edgeOffsets.reserve(m_routers.size() + 1);
+    for (uint32_t v = 0; v < m_routers.size(); ++v) {
+        m_edgeOffsets.push_back(m_edgeTargets.size());
+
+        if (!m_routers[v]->GetLocalPrefixes().empty()) {
+            m_origins.push_back(v);
+        }
+
+        for (const auto& incidency : m_routers[v]->GetIncidencies()) {
+            auto target = vertexIds.find(PeekPointer(std::get<2>(incidency)));
+            if (target == vertexIds.end()) {
+                continue; // not reachable through NodeList or ChannelList
+            }
+            m_edgeTargets.push_back(target->second);
+
+            const shared_ptr<Face>& face = std::get<1>(incidency);
+            if (face == nullptr) {
+                m_edgeFaces.push_back(NO_FACE);
+                m_edgeCosts.push_back(0);
+                continue;
+            }
+
+            auto faceId = faceIds.emplace(face.get(), m_faces.size());
+            if (faceId.second) {
+                m_faces.push_back(face);
+                m_faceCosts.push_back(static_cast<uint16_t>(face->getMetric()));
+            }
+            m_edgeFaces.push_back(faceId.first->second);
+            m_edgeCosts.push_back(m_faceCosts[faceId.first->second]);
+        }
+    }
+    m_edgeOffsets.push_back(m_edgeTargets.size());
+}
+
+std::vector<uint32_t>
+GlobalRoutingGraph::getOutFaces(uint32_t vertex) const
+{
+    std::vector<uint32_t> faces;
+    for (uint32_t e = m_edgeOffsets[vertex]; e < m_edgeOffsets[vertex + 1]; ++e) {
+        if (m_edgeFaces[e] != NO_FACE && std::find(faces.begin(), faces.end(), m_edgeFaces[e]) == faces.end()) {
+            faces.push_back(m_edgeFaces[e]);
+        }
+    }
+    return faces;
+}
+
+void
+GlobalRoutingGraph::findRoutes(uint32_t source, uint32_t enabledFace, std::vector<Route>& routes) const
+{
+    std::vector<uint32_t> costs(m_routers.size(), COST_INFINITY);
+    std::vector<uint32_t> firstHops(m_routers.size(), NO_FACE);
+
+    typedef std::pair<uint32_t, uint32_t> QueueItem; // (cost, vertex)
+    std::priority_queue<QueueItem, std::vector<QueueItem>, std::greater<QueueItem>> queue;
+
+    costs[source] = 0;
+    queue.emplace(0, source);
+    while (!queue.empty()) {
+        uint32_t cost = queue.top().first;
+        uint32_t u = queue.top().second;
+        queue.pop();
+        if (cost != costs[u]) {
+            continue; // stale queue item
+        }
+
+        for (uint32_t e = m_edgeOffsets[u]; e < m_edgeOffsets[u + 1]; ++e) {
+            uint32_t edgeCost = m_edgeCosts[e];
+            if (u == source && enabledFace != NO_FACE && m_edgeFaces[e] != enabledFace) {
+                edgeCost = COST_DISABLED;
+            }
+
+            uint32_t v = m_edgeTargets[e];
+            uint32_t newCost = cost + edgeCost;
+            if (newCost < costs[v]) {
+                costs[v] = newCost;
+                firstHops[v] = firstHops[u] != NO_FACE ? firstHops[u] : m_edgeFaces[e];
+                queue.emplace(newCost, v);
+            }
+        }
+    }
+
+    routes.clear();
+    for (uint32_t origin : m_origins) {
+        if (origin == source || firstHops[origin] == NO_FACE) {
+            continue;
+        }
+        if (enabledFace != NO_FACE && (firstHops[origin] != enabledFace || m_faceCosts[enabledFace] == COST_DISABLED)) {
+            continue;
+        }
+        routes.push_back({origin, firstHops[origin], costs[origin]});
+    }
+}
+
+} // namespace ndn
+} // namespace ns3
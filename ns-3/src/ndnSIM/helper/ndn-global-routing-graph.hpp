@@ -0,0 +1,137 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_GLOBAL_ROUTING_GRAPH_H
+#define NDN_GLOBAL_ROUTING_GRAPH_H
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+
+#include <limits>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-helpers
+ * @brief Immutable compressed sparse row (CSR) snapshot of the GlobalRouter graph
+ *
+ * The snapshot assigns dense integer ids to all GlobalRouter instances (nodes first, then
+ * multi-access channels) and stores edges, edge weights (face metrics at snapshot time), and
+ * first-hop faces in flat arrays.  Shortest path computations only read these arrays, so they
+ * can run concurrently on worker threads; ns-3 and NFD objects are only accessed by the
+ * thread that created the snapshot.
+ *
+ * Path costs follow the semantics of the Boost.Graph based implementation
+ * (boost-graph-ndn-global-routing-helper.hpp): the cost of an edge is the metric of its face
+ * (0 for edges leaving a channel), and destinations whose cost is not below
+ * std::numeric_limits<uint16_t>::max() are unreachable.
+ */
+class GlobalRoutingGraph {
+  public:
+    /**
+     * @brief Special face index for edges without a face and for unreachable destinations
+     */
+    static constexpr uint32_t NO_FACE = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * @brief Path cost that is treated as infinity
+     */
+    static constexpr uint32_t COST_INFINITY = std::numeric_limits<uint16_t>::max();
+
+    /**
+     * @brief Face metric that CalculateAllPossibleRoutes uses to disable a face
+     */
+    static constexpr uint32_t COST_DISABLED = std::numeric_limits<uint16_t>::max() - 1;
+
+    /**
+     * @brief Shortest path from a source to an origin (a vertex with local prefixes)
+     */
+    struct Route {
+        uint32_t origin; ///< vertex id of the destination
+        uint32_t face;   ///< index of the first-hop face, see getFace()
+        uint32_t cost;   ///< total path cost
+    };
+
+    /**
+     * @brief Take a snapshot of all GlobalRouter instances in NodeList and ChannelList
+     */
+    GlobalRoutingGraph();
+
+    /**
+     * @brief Vertex ids of GlobalRouters that are aggregated to nodes, in NodeList order
+     */
+    const std::vector<uint32_t>&
+    getSources() const
+    {
+        return m_sources;
+    }
+
+    Ptr<GlobalRouter>
+    getRouter(uint32_t vertex) const
+    {
+        return m_routers[vertex];
+    }
+
+    const shared_ptr<Face>&
+    getFace(uint32_t face) const
+    {
+        return m_faces[face];
+    }
+
+    /**
+     * @brief Distinct faces on the outgoing edges of @p vertex, in edge order
+     */
+    std::vector<uint32_t>
+    getOutFaces(uint32_t vertex) const;
+
+    /**
+     * @brief Compute shortest paths from @p source to all origins
+     *
+     * If @p enabledFace is not NO_FACE, all outgoing edges of @p source except those via
+     * @p enabledFace are costed with COST_DISABLED, and only routes via @p enabledFace whose
+     * face metric is not COST_DISABLED are returned (CalculateAllPossibleRoutes semantics).
+     *
+     * This method is thread-safe.
+     *
+     * @param[out] routes reachable origins (excluding @p source), in vertex id order
+     */
+    void
+    findRoutes(uint32_t source, uint32_t enabledFace, std::vector<Route>& routes) const;
+
+  private:
+    // main-thread only
+    std::vector<Ptr<GlobalRouter>> m_routers;
+    std::vector<shared_ptr<Face>> m_faces;
+
+    // read-only after construction
+    std::vector<uint32_t> m_sources;
+    std::vector<uint32_t> m_origins;
+    std::vector<uint32_t> m_edgeOffsets; ///< edges of vertex v are [m_edgeOffsets[v], m_edgeOffsets[v + 1])
+    std::vector<uint32_t> m_edgeTargets;
+    std::vector<uint32_t> m_edgeFaces;
+    std::vector<uint32_t> m_edgeCosts;
+    std::vector<uint32_t> m_faceCosts;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_GLOBAL_ROUTING_GRAPH_H
@@ -29,6 +29,7 @@
 #include "helper/ndn-fib-helper.hpp"
 #include "model/ndn-net-device-transport.hpp"
 #include "model/ndn-global-router.hpp"
+#include "helper/ndn-global-routing-graph.hpp"
 
 #include "daemon/table/fib.hpp"
 #include "daemon/fw/forwarder.hpp"
@@ -47,22 +48,20 @@
 #include "ns3/channel-list.h"
 #include "ns3/object-factory.h"
 
-#include <boost/lexical_cast.hpp>
-#include <boost/foreach.hpp>
-#include <boost/concept/assert.hpp>
-#include <boost/graph/dijkstra_shortest_paths.hpp>
-
-#include <unordered_map>
-
-#include "boost-graph-ndn-global-routing-helper.hpp"
-
-#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <thread>
 
 NS_LOG_COMPONENT_DEFINE("ndn.GlobalRoutingHelper");
 
 namespace ns3 {
 namespace ndn {
 
+bool GlobalRoutingHelper::m_isDirectFibInstallation = false;
+bool GlobalRoutingHelper::m_shouldUpdateRib = false;
+uint32_t GlobalRoutingHelper::m_nRouteCalculationThreads = 0;
+
 void
 GlobalRoutingHelper::Install(Ptr<Node> node)
 {
@@ -215,172 +214,149 @@ GlobalRoutingHelper::AddOriginsForAll()
 }
 
 void
-GlobalRoutingHelper::CalculateRoutes()
+GlobalRoutingHelper::SetDirectFibInstallation(bool isEnabled, bool updateRib)
 {
-    /**
-     * Implementation of route calculation is heavily based on Boost Graph Library
-     * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-     */
-
-    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-    boost::NdnGlobalRouterGraph graph;
-    // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+    m_isDirectFibInstallation = isEnabled;
+    m_shouldUpdateRib = updateRib;
+}
 
-    // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-    // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-    // the graph, which
-    // is not obviously how implement in an efficient manner
-    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-        Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-        if (source == 0) {
-            NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-            continue;
-        }
+void
+GlobalRoutingHelper::InstallRoutes(Ptr<Node> node, const std::vector<FibHelper::Route>& routes)
+{
+    if (m_isDirectFibInstallation) {
+        FibHelper::AddRoutes(node, routes, m_shouldUpdateRib);
+        return;
+    }
 
-        boost::DistancesMap distances;
-
-        dijkstra_shortest_paths(graph, source,
-                                // predecessor_map (boost::ref(predecessors))
-                                // .
-                                distance_map(boost::ref(distances))
-                                  .distance_inf(boost::WeightInf)
-                                  .distance_zero(boost::WeightZero)
-                                  .distance_compare(boost::WeightCompare())
-                                  .distance_combine(boost::WeightCombine()));
-
-        // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
-
-        Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-        shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
-        NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId());
-        for (const auto& dist : distances) {
-            if (dist.first == source)
-                continue;
-            else {
-                // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-                if (std::get<0>(dist.second) == 0) {
-                    // cout << " is unreachable" << endl;
-                }
-                else {
-                    for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-                        NS_LOG_DEBUG(" prefix " << prefix << " reachable via face " << *std::get<0>(dist.second)
-                                                << " with distance " << std::get<1>(dist.second) << " with delay "
-                                                << std::get<2>(dist.second));
-
-                        FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second), std::get<1>(dist.second));
-                    }
-                }
-            }
-        }
+    for (const auto& route : routes) {
+        FibHelper::AddRoute(node, route.prefix, route.face, route.metric);
     }
 }
 
+namespace {
+
+/**
+ * @brief Compute routes for @p graph sources in blocks on @p nThreads threads, and pass the
+ *        results of each source to @p install on the calling thread, in source order
+ *
+ * Results are buffered for at most one block of sources at a time, which bounds memory
+ * usage on large topologies.  @p calculate always receives an empty vector.
+ */
 void
-GlobalRoutingHelper::CalculateAllPossibleRoutes()
+calculateInParallel(const GlobalRoutingGraph& graph, uint32_t nThreads,
+                    const std::function<void(uint32_t source, std::vector<GlobalRoutingGraph::Route>&)>& calculate,
+                    const std::function<void(uint32_t source, const std::vector<GlobalRoutingGraph::Route>&)>& install)
 {
-    /**
-     * Implementation of route calculation is heavily based on Boost Graph Library
-     * See http://www.boost.org/doc/libs/1_49_0/libs/graph/doc/table_of_contents.html for more details
-     */
-
-    BOOST_CONCEPT_ASSERT((boost::VertexListGraphConcept<boost::NdnGlobalRouterGraph>));
-    BOOST_CONCEPT_ASSERT((boost::IncidenceGraphConcept<boost::NdnGlobalRouterGraph>));
-
-    boost::NdnGlobalRouterGraph graph;
-    // typedef graph_traits < NdnGlobalRouterGraph >::vertex_descriptor vertex_descriptor;
+    const std::vector<uint32_t>& sources = graph.getSources();
+    const size_t blockSize = static_cast<size_t>(nThreads) * 64;
+
+    std::vector<std::vector<GlobalRoutingGraph::Route>> results;
+    for (size_t blockBegin = 0; blockBegin < sources.size(); blockBegin += blockSize) {
+        size_t blockEnd = std::min(sources.size(), blockBegin + blockSize);
+        results.resize(blockEnd - blockBegin);
+
+        std::atomic<size_t> next(blockBegin);
+        auto worker = [&] {
+            for (size_t i = next++; i < blockEnd; i = next++) {
+                // the vectors are reused from the previous block
+                results[i - blockBegin].clear();
+                calculate(sources[i], results[i - blockBegin]);
+            }
+        };
 
-    // For now we doing Dijkstra for every node.  Can be replaced with Bellman-Ford or Floyd-Warshall.
-    // Other algorithms should be faster, but they need additional EdgeListGraph concept provided by
-    // the graph, which
-    // is not obviously how implement in an efficient manner
-    for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
-        Ptr<GlobalRouter> source = (*node)->GetObject<GlobalRouter>();
-        if (source == 0) {
-            NS_LOG_DEBUG("Node " << (*node)->GetId() << " does not export GlobalRouter interface");
-            continue;
+        std::vector<std::thread> threads;
+        for (uint32_t i = 1; i < nThreads && i < blockEnd - blockBegin; ++i) {
+            threads.emplace_back(worker);
         }
-
-        Ptr<L3Protocol> L3protocol = (*node)->GetObject<L3Protocol>();
-        shared_ptr<nfd::Forwarder> forwarder = L3protocol->getForwarder();
-
-        NS_LOG_DEBUG("Reachability from Node: " << source->GetObject<Node>()->GetId() << " ("
-                                                << Names::FindName(source->GetObject<Node>()) << ")");
-
-        Ptr<L3Protocol> l3 = source->GetObject<L3Protocol>();
-        NS_ASSERT(l3 != 0);
-
-        // remember interface statuses
-        std::list<nfd::FaceId> faceIds;
-        std::unordered_map<nfd::FaceId, uint16_t> originalMetrics;
-        for (auto& nfdFace : l3->getFaceTable()) {
-            faceIds.push_back(nfdFace.getId());
-            originalMetrics[nfdFace.getId()] = nfdFace.getMetric();
-            nfdFace.setMetric(std::numeric_limits<uint16_t>::max() - 1);
-            // value std::numeric_limits<uint16_t>::max () MUST NOT be used (reserved)
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
         }
 
-        for (auto& faceId : faceIds) {
-            auto* face = l3->getFaceTable().get(faceId);
-            NS_ASSERT(face != nullptr);
-            auto transport = dynamic_cast<NetDeviceTransport*>(face->getTransport());
-            if (transport == nullptr) {
-                NS_LOG_DEBUG("Skipping non ndnSIM-specific transport face");
-                continue;
-            }
-
-            // enabling only faceId
-            face->setMetric(originalMetrics[faceId]);
-
-            boost::DistancesMap distances;
-
-            NS_LOG_DEBUG("-----------");
+        for (size_t i = blockBegin; i < blockEnd; ++i) {
+            install(sources[i], results[i - blockBegin]);
+        }
+    }
+}
 
-            dijkstra_shortest_paths(graph, source,
-                                    // predecessor_map (boost::ref(predecessors))
-                                    // .
-                                    distance_map(boost::ref(distances))
-                                      .distance_inf(boost::WeightInf)
-                                      .distance_zero(boost::WeightZero)
-                                      .distance_compare(boost::WeightCompare())
-                                      .distance_combine(boost::WeightCombine()));
+} // namespace
 
-            // NS_LOG_DEBUG (predecessors.size () << ", " << distances.size ());
+void
+GlobalRoutingHelper::SetRouteCalculationThreads(uint32_t nThreads)
+{
+    m_nRouteCalculationThreads = nThreads;
+}
 
-            for (const auto& dist : distances) {
-                if (dist.first == source)
-                    continue;
-                else {
-                    // cout << "  Node " << dist.first->GetObject<Node> ()->GetId ();
-                    if (std::get<0>(dist.second) == 0) {
-                        // cout << " is unreachable" << endl;
-                    }
-                    else {
-                        for (const auto& prefix : dist.first->GetLocalPrefixes()) {
-                            NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *std::get<0>(dist.second)
-                                                    << " with distance " << std::get<1>(dist.second) << " with delay "
-                                                    << std::get<2>(dist.second));
-
-                            if (std::get<0>(dist.second)->getMetric() == std::numeric_limits<uint16_t>::max() - 1)
-                                continue;
-
-                            FibHelper::AddRoute(*node, *prefix, std::get<0>(dist.second), std::get<1>(dist.second));
-                        }
-                    }
-                }
-            }
+uint32_t
+GlobalRoutingHelper::GetRouteCalculationThreads()
+{
+    if (m_nRouteCalculationThreads != 0) {
+        return m_nRouteCalculationThreads;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
 
-            // disabling the face again
-            face->setMetric(std::numeric_limits<uint16_t>::max() - 1);
-        }
+void
+GlobalRoutingHelper::CalculateRoutes()
+{
+    // Dijkstra for every node, on a CSR snapshot of the GlobalRouter graph, with sources
+    // distributed over worker threads.  FIB updates are applied on this thread afterwards.
+    GlobalRoutingGraph graph;
+
+    calculateInParallel(
+      graph, GetRouteCalculationThreads(),
+      [&graph](uint32_t source, std::vector<GlobalRoutingGraph::Route>& routes) {
+          graph.findRoutes(source, GlobalRoutingGraph::NO_FACE, routes);
+      },
+      [&graph](uint32_t source, const std::vector<GlobalRoutingGraph::Route>& routes) {
+          Ptr<Node> node = graph.getRouter(source)->GetObject<Node>();
+          NS_LOG_DEBUG("Reachability from Node: " << node->GetId());
+
+          std::vector<FibHelper::Route> fibRoutes;
+          for (const auto& route : routes) {
+              const shared_ptr<Face>& face = graph.getFace(route.face);
+              for (const auto& prefix : graph.getRouter(route.origin)->GetLocalPrefixes()) {
+                  NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *face << " with distance "
+                                          << route.cost);
+                  fibRoutes.push_back({*prefix, face, static_cast<int32_t>(route.cost)});
+              }
+          }
+          InstallRoutes(node, fibRoutes);
+      });
+}
 
-        // recover original interface statuses
-        for (auto& i : originalMetrics) {
-            l3->getFaceTable().get(i.first)->setMetric(i.second);
-        }
-    }
+void
+GlobalRoutingHelper::CalculateAllPossibleRoutes()
+{
+    // For every node and each of its faces, Dijkstra with all other faces of the node
+    // disabled (i.e., with metric std::numeric_limits<uint16_t>::max() - 1); see
+    // GlobalRoutingGraph::findRoutes.  Face metrics themselves are not modified.
+    GlobalRoutingGraph graph;
+
+    calculateInParallel(
+      graph, GetRouteCalculationThreads(),
+      [&graph](uint32_t source, std::vector<GlobalRoutingGraph::Route>& routes) {
+          std::vector<GlobalRoutingGraph::Route> faceRoutes;
+          for (uint32_t face : graph.getOutFaces(source)) {
+              graph.findRoutes(source, face, faceRoutes);
+              routes.insert(routes.end(), faceRoutes.begin(), faceRoutes.end());
+          }
+      },
+      [&graph](uint32_t source, const std::vector<GlobalRoutingGraph::Route>& routes) {
+          Ptr<Node> node = graph.getRouter(source)->GetObject<Node>();
+          NS_LOG_DEBUG("Reachability from Node: " << node->GetId() << " (" << Names::FindName(node) << ")");
+
+          std::vector<FibHelper::Route> fibRoutes;
+          for (const auto& route : routes) {
+              const shared_ptr<Face>& face = graph.getFace(route.face);
+              for (const auto& prefix : graph.getRouter(route.origin)->GetLocalPrefixes()) {
+                  NS_LOG_DEBUG(" prefix " << *prefix << " reachable via face " << *face << " with distance "
+                                          << route.cost);
+                  fibRoutes.push_back({*prefix, face, static_cast<int32_t>(route.cost)});
+              }
+          }
+          InstallRoutes(node, fibRoutes);
+      });
 }
 
 } // namespace ndn
@@ -21,6 +21,7 @@
 #define NDN_GLOBAL_ROUTING_HELPER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ns3/ndnSIM/helper/ndn-fib-helper.hpp"
 
 #include "ns3/ptr.h"
 
@@ -114,8 +115,40 @@ class GlobalRoutingHelper {
      */
     static void CalculateAllPossibleRoutes();
 
+    /**
+     * @brief Select how the Calculate*Routes methods install the calculated routes
+     *
+     * By default, each route is installed with FibHelper::AddRoute, i.e., as a signed command
+     * Interest processed by the FIB manager of the node.  In direct mode, the routes of each
+     * node are collected and written to its FIB in one batch with FibHelper::AddRoutes, which
+     * considerably reduces setup time on large topologies.
+     *
+     * @param isEnabled Whether to install routes directly into the FIB
+     * @param updateRib In direct mode, whether to also record the routes in the RIB of each node
+     */
+    static void SetDirectFibInstallation(bool isEnabled, bool updateRib = false);
+
+    /**
+     * @brief Set the number of threads used by CalculateRoutes and CalculateAllPossibleRoutes
+     *
+     * Shortest paths are computed on worker threads from an immutable snapshot of the
+     * GlobalRouter graph, while FIB updates are always applied on the calling thread.
+     *
+     * @param nThreads Number of threads, or 0 (default) to use one thread per hardware thread
+     */
+    static void SetRouteCalculationThreads(uint32_t nThreads);
+
   private:
     void Install(Ptr<Channel> channel);
+
+    static void InstallRoutes(Ptr<Node> node, const std::vector<FibHelper::Route>& routes);
+
+    static uint32_t GetRouteCalculationThreads();
+
+  private:
+    static bool m_isDirectFibInstallation;
+    static bool m_shouldUpdateRib;
+    static uint32_t m_nRouteCalculationThreads;
 };
 
 } // namespace ndn
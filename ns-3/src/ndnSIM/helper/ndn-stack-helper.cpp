@@ -43,6 +43,7 @@
 #include "ns3/ndnSIM/NFD/daemon/face/generic-link-service.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-priority-fifo.hpp"
 #include "ns3/ndnSIM/NFD/daemon/table/cs-policy-lru.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/cs-decision-policy.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.StackHelper");
 
@@ -52,6 +53,7 @@ namespace ndn {
 StackHelper::StackHelper()
   : m_isForwarderStatusManagerDisabled(false)
   , m_isStrategyChoiceManagerDisabled(false)
+  , m_isDataPlaneOnly(false)
   , m_needSetDefaultRoutes(false)
 {
     setCustomNdnCxxClocks();
@@ -115,6 +117,7 @@ void
 StackHelper::setCsSize(size_t maxSize)
 {
     m_maxCsSize = maxSize;
+    m_config = nullptr;
 }
 
 void
@@ -133,6 +136,21 @@ StackHelper::setPolicy(const std::string& policy)
     }
 }
 
+void
+StackHelper::setCacheDecisionPolicy(const std::string& policy)
+{
+    auto policyNames = nfd::cs::DecisionPolicy::getPolicyNames();
+    if (policyNames.count(policy) == 0) {
+        std::ostringstream os;
+        for (const auto& name : policyNames) {
+            os << " " << name;
+        }
+        NS_FATAL_ERROR("Cache decision policy " << policy << " not found, available policies:" << os.str());
+    }
+
+    m_csDecisionPolicyCreationFunc = [policy] { return nfd::cs::DecisionPolicy::create(policy); };
+}
+
 void
 StackHelper::Install(const NodeContainer& c) const
 {
@@ -166,17 +184,29 @@ StackHelper::doInstall(Ptr<Node> node) const
     // async install to ensure proper context
     Ptr<L3Protocol> ndn = m_ndnFactory.Create<L3Protocol>();
 
-    if (m_isForwarderStatusManagerDisabled) {
-        ndn->getConfig().put("ndnSIM.disable_forwarder_status_manager", true);
-    }
+    // 所有节点共享同一份配置, 只在 helper 的设置改变后重新生成一次
+    if (m_config == nullptr) {
+        m_config = make_shared<nfd::ConfigSection>(ndn->getConfig());
 
-    if (m_isStrategyChoiceManagerDisabled) {
-        ndn->getConfig().put("ndnSIM.disable_strategy_choice_manager", true);
-    }
+        if (m_isForwarderStatusManagerDisabled) {
+            m_config->put("ndnSIM.disable_forwarder_status_manager", true);
+        }
 
-    ndn->getConfig().put("tables.cs_max_packets", m_maxCsSize); // 你手动设置的缓存容量,怎么和cs关联起来
+        if (m_isStrategyChoiceManagerDisabled) {
+            m_config->put("ndnSIM.disable_strategy_choice_manager", true);
+            m_config->get_child("authorizations.authorize.privileges").erase("strategy-choice");
+        }
+
+        if (m_isDataPlaneOnly) {
+            m_config->put("ndnSIM.data_plane_only", true);
+        }
+
+        m_config->put("tables.cs_max_packets", m_maxCsSize); // 你手动设置的缓存容量,怎么和cs关联起来
+    }
+    ndn->setSharedConfig(m_config);
 
     ndn->setCsReplacementPolicy(m_csPolicyCreationFunc);
+    ndn->setCsDecisionPolicy(m_csDecisionPolicyCreationFunc);
 
 	// std::cout << "\tnode->AggregateObject(ndn)" << std::endl;
     // Aggregate L3Protocol on node (must be after setting ndnSIM CS) 必须在设置CS之后?
@@ -372,12 +402,21 @@ void
 StackHelper::disableStrategyChoiceManager()
 {
     m_isStrategyChoiceManagerDisabled = true;
+    m_config = nullptr;
 }
 
 void
 StackHelper::disableForwarderStatusManager()
 {
     m_isForwarderStatusManagerDisabled = true;
+    m_config = nullptr;
+}
+
+void
+StackHelper::setDataPlaneOnly()
+{
+    m_isDataPlaneOnly = true;
+    m_config = nullptr;
 }
 
 void
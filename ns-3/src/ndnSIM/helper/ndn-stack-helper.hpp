@@ -33,6 +33,7 @@
 namespace nfd {
 namespace cs {
 class Policy;
+class DecisionPolicy;
 } // namespace cs
 } // namespace nfd
 
@@ -82,6 +83,16 @@ class StackHelper : boost::noncopyable {
      */
     void setPolicy(const std::string& policy);
 
+    /**
+     * @brief Set the cache decision (placement) policy for NFD's Content Store
+     * @param policy name of a policy registered with NFD_REGISTER_CS_DECISION_POLICY,
+     *               e.g., "lce" (default) or "lcd"
+     *
+     * Like setPolicy, this applies to the nodes installed afterwards, so that different nodes
+     * can use different policies.
+     */
+    void setCacheDecisionPolicy(const std::string& policy);
+
     typedef Callback<shared_ptr<Face>, Ptr<Node>, Ptr<L3Protocol>, Ptr<NetDevice>> FaceCreateCallback;
 
     /**
@@ -202,6 +213,19 @@ class StackHelper : boost::noncopyable {
      */
     void disableForwarderStatusManager();
 
+    /**
+     * \brief Install only the data plane of NFD: Forwarder and FaceTable
+     *
+     * Nodes installed afterwards get no management (Dispatcher, managers, CommandAuthenticator),
+     * no FaceSystem, no RIB service and no internal faces. FibHelper and StrategyChoiceHelper
+     * then modify FIB and StrategyChoice directly instead of sending signed commands, and the
+     * tables section of the NFD config (e.g., setCsSize) is still applied.
+     *
+     * Intended for large topologies where management is not used; L3Protocol::injectInterest,
+     * getRibService and getFibManager are not available on such nodes.
+     */
+    void setDataPlaneOnly();
+
     /**
      * @brief Set face metric of all faces connected through PointToPoint channel to channel latency
      */
@@ -220,6 +244,7 @@ class StackHelper : boost::noncopyable {
 
     bool m_isForwarderStatusManagerDisabled;
     bool m_isStrategyChoiceManagerDisabled;
+    bool m_isDataPlaneOnly;
 
   public:
     void setCustomNdnCxxClocks();
@@ -230,11 +255,17 @@ class StackHelper : boost::noncopyable {
     bool m_needSetDefaultRoutes;
     size_t m_maxCsSize = 100;
 
+    /// NFD config shared by the nodes installed by this helper, rebuilt after a setting changes
+    mutable shared_ptr<nfd::ConfigSection> m_config;
+
     typedef std::function<std::unique_ptr<nfd::cs::Policy>()> PolicyCreationCallback;
     PolicyCreationCallback m_csPolicyCreationFunc;
 
     std::map<std::string, PolicyCreationCallback> m_csPolicies;
 
+    typedef std::function<std::unique_ptr<nfd::cs::DecisionPolicy>()> DecisionPolicyCreationCallback;
+    DecisionPolicyCreationCallback m_csDecisionPolicyCreationFunc;
+
     typedef std::list<std::pair<TypeId, FaceCreateCallback>> NetDeviceCallbackList;
     NetDeviceCallbackList m_netDeviceCallbacks;
 };
@@ -22,6 +22,7 @@
 #include "ns3/log.h"
 
 #include "ndn-stack-helper.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
 
 namespace ns3 {
 namespace ndn {
@@ -33,6 +34,19 @@ void
 StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node> node)
 {
     NS_LOG_DEBUG("Strategy choice command was initialized");
+
+    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
+    if (l3protocol->isDataPlaneOnly()) {
+        // no StrategyChoiceManager on the node: change StrategyChoice directly
+        auto result = l3protocol->getForwarder()->getStrategyChoice().insert(parameters.getName(),
+                                                                             parameters.getStrategy());
+        if (!result) {
+            NS_LOG_WARN("Cannot set strategy " << parameters.getStrategy() << " for " << parameters.getName() << ": "
+                                               << result);
+        }
+        return;
+    }
+
     Block encodedParameters(parameters.wireEncode());
 
     Name commandName("/localhost/nfd/strategy-choice");
@@ -43,7 +57,6 @@ StrategyChoiceHelper::sendCommand(const ControlParameters& parameters, Ptr<Node>
     command->setCanBePrefix(false);
     StackHelper::getKeyChain().sign(*command);
 
-    Ptr<L3Protocol> l3protocol = node->GetObject<L3Protocol>();
     l3protocol->injectInterest(*command);
 }
 
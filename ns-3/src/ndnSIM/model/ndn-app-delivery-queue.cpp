@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-app-delivery-queue.hpp"
+
+#include "ns3/simulator.h"
+
+#include "apps/ndn-app.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+AppDeliveryQueue::Guard::Guard(AppDeliveryQueue* queue)
+  : m_queue(queue)
+{
+    if (m_queue != nullptr) {
+        ++m_queue->m_depth;
+    }
+}
+
+AppDeliveryQueue::Guard::~Guard()
+{
+    if (m_queue == nullptr) {
+        return;
+    }
+
+    --m_queue->m_depth;
+    if (m_queue->m_depth == 0) {
+        m_queue->drain();
+    }
+}
+
+AppDeliveryQueue::AppDeliveryQueue() = default;
+
+AppDeliveryQueue::~AppDeliveryQueue() = default;
+
+void
+AppDeliveryQueue::deliverInterest(Ptr<App> app, shared_ptr<const Interest> interest)
+{
+    enqueue({app, std::move(interest), nullptr, nullptr});
+}
+
+void
+AppDeliveryQueue::deliverData(Ptr<App> app, shared_ptr<const Data> data)
+{
+    enqueue({app, nullptr, std::move(data), nullptr});
+}
+
+void
+AppDeliveryQueue::deliverNack(Ptr<App> app, shared_ptr<const lp::Nack> nack)
+{
+    enqueue({app, nullptr, nullptr, std::move(nack)});
+}
+
+void
+AppDeliveryQueue::enqueue(Delivery delivery)
+{
+    m_queue.push_back(std::move(delivery));
+
+    // 在 Guard 内或正在分发时, 由外层负责分发; 否则本事件结束后统一分发一次
+    if (m_depth == 0 && !m_isDrainScheduled) {
+        m_isDrainScheduled = true;
+        ++m_nScheduledDrains;
+        Simulator::ScheduleNow(&AppDeliveryQueue::onScheduledDrain, this);
+    }
+}
+
+void
+AppDeliveryQueue::onScheduledDrain()
+{
+    m_isDrainScheduled = false;
+    drain();
+}
+
+void
+AppDeliveryQueue::drain()
+{
+    ++m_depth;
+    while (!m_queue.empty()) {
+        Delivery delivery = std::move(m_queue.front());
+        m_queue.pop_front();
+
+        if (delivery.interest != nullptr) {
+            delivery.app->OnInterest(std::move(delivery.interest));
+        }
+        else if (delivery.data != nullptr) {
+            delivery.app->OnData(std::move(delivery.data));
+        }
+        else {
+            delivery.app->OnNack(std::move(delivery.nack));
+        }
+    }
+    --m_depth;
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,121 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2015  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_APP_DELIVERY_QUEUE_HPP
+#define NDN_APP_DELIVERY_QUEUE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include "ns3/ptr.h"
+
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+class App;
+
+/**
+ * \ingroup ndn-face
+ * \brief Per-node queue of packets going from the forwarder to applications
+ *
+ * By default AppLinkService hands every packet to its application in a separate
+ * Simulator::ScheduleNow event, so that the application never runs inside a forwarding
+ * pipeline. When L3Protocol::DirectAppDelivery is enabled, AppLinkService puts the packet into
+ * this queue instead, and the queue delivers it as soon as the forwarder has returned:
+ *
+ * - if the packet is sent while a Guard is held (NetDeviceTransport holds one while a received
+ *   packet goes through the forwarder), it is delivered when the outermost Guard is released;
+ * - otherwise (e.g., a Nack sent from a timer), one ScheduleNow event delivers all packets queued
+ *   on the node during the current event.
+ *
+ * Packets are delivered in the order they were sent, at the simulation time they were sent.
+ * Applications are never entered recursively: packets sent to applications during a delivery
+ * are appended to the queue and delivered after it returns.
+ * Compared to one event per packet, only the order relative to other events scheduled for the
+ * same time on other nodes may differ.
+ */
+class AppDeliveryQueue : boost::noncopyable {
+  public:
+    /**
+     * \brief Defers deliveries on a node until the outermost Guard is released
+     */
+    class Guard : boost::noncopyable {
+      public:
+        /**
+         * \param queue the queue to guard; nullptr makes the guard a no-op
+         */
+        explicit Guard(AppDeliveryQueue* queue);
+
+        ~Guard();
+
+      private:
+        AppDeliveryQueue* m_queue;
+    };
+
+    AppDeliveryQueue();
+
+    ~AppDeliveryQueue();
+
+    void
+    deliverInterest(Ptr<App> app, shared_ptr<const Interest> interest);
+
+    void
+    deliverData(Ptr<App> app, shared_ptr<const Data> data);
+
+    void
+    deliverNack(Ptr<App> app, shared_ptr<const lp::Nack> nack);
+
+    /**
+     * \return number of ScheduleNow events used for deliveries so far
+     */
+    uint64_t
+    getNScheduledDrains() const
+    {
+        return m_nScheduledDrains;
+    }
+
+  private:
+    struct Delivery {
+        Ptr<App> app;
+        shared_ptr<const Interest> interest;
+        shared_ptr<const Data> data;
+        shared_ptr<const lp::Nack> nack;
+    };
+
+    void
+    enqueue(Delivery delivery);
+
+    void
+    drain();
+
+    void
+    onScheduledDrain();
+
+  private:
+    std::deque<Delivery> m_queue;
+    int m_depth = 0; // number of held Guards, plus one while draining
+    bool m_isDrainScheduled = false;
+    uint64_t m_nScheduledDrains = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_APP_DELIVERY_QUEUE_HPP
@@ -26,6 +26,8 @@
 #include "ns3/simulator.h"
 
 #include "apps/ndn-app.hpp"
+#include "ndn-l3-protocol.hpp"
+#include "ndn-app-delivery-queue.hpp"
 
 NS_LOG_COMPONENT_DEFINE("ndn.AppLinkService");
 
@@ -35,10 +37,16 @@ namespace ndn {
 AppLinkService::AppLinkService(Ptr<App> app)
   : m_node(app->GetNode())
   , m_app(app)
+  , m_appDeliveryQueue(nullptr)
 {
     NS_LOG_FUNCTION(this << app);
 
     NS_ASSERT(m_app != 0);
+
+    Ptr<L3Protocol> ndn = m_node->GetObject<L3Protocol>();
+    if (ndn != 0) {
+        m_appDeliveryQueue = ndn->getAppDeliveryQueue();
+    }
 }
 
 AppLinkService::~AppLinkService()
@@ -54,6 +62,10 @@ AppLinkService::doSendInterest(const Interest& interest, const nfd::EndpointId&
     // to decouple callbacks
     // 添加了事件App::OnInterest,而该函数为虚函数
     // 实际添加的是Producer::OnInterest事件
+    if (m_appDeliveryQueue != nullptr) {
+        m_appDeliveryQueue->deliverInterest(m_app, interest.shared_from_this());
+        return;
+    }
     Simulator::ScheduleNow(&App::OnInterest, m_app, interest.shared_from_this());
 }
 
@@ -65,6 +77,10 @@ AppLinkService::doSendData(const Data& data, const nfd::EndpointId& endpoint)
 
     // to decouple callbacks
     // 添加 Consumer::onData 事件
+    if (m_appDeliveryQueue != nullptr) {
+        m_appDeliveryQueue->deliverData(m_app, data.shared_from_this());
+        return;
+    }
     Simulator::ScheduleNow(&App::OnData, m_app, data.shared_from_this());
 }
 
@@ -74,7 +90,11 @@ AppLinkService::doSendNack(const lp::Nack& nack, const nfd::EndpointId& endpoint
     NS_LOG_FUNCTION(this << &nack);
 
     // to decouple callbacks
-    Simulator::ScheduleNow(&App::OnNack, m_app, make_shared<lp::Nack>(nack));
+    if (m_appDeliveryQueue != nullptr) {
+        m_appDeliveryQueue->deliverNack(m_app, nack.shared_from_this());
+        return;
+    }
+    Simulator::ScheduleNow(&App::OnNack, m_app, nack.shared_from_this());
 }
 
 //
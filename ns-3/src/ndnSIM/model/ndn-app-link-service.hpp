@@ -31,6 +31,7 @@ class Node;
 namespace ndn {
 
 class App;
+class AppDeliveryQueue;
 
 /**
  * \ingroup ndn-face
@@ -71,6 +72,7 @@ class AppLinkService : public nfd::face::LinkService {
   private:
     Ptr<Node> m_node;
     Ptr<App> m_app;
+    AppDeliveryQueue* m_appDeliveryQueue; ///< \brief nullptr unless L3Protocol::DirectAppDelivery
 };
 
 } // namespace ndn
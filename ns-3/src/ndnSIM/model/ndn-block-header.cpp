@@ -19,16 +19,13 @@
 
 #include "ndn-block-header.hpp"
 
-#include <iosfwd>
-#include <boost/iostreams/concepts.hpp>
-#include <boost/iostreams/stream.hpp>
+#include <algorithm>
 
 #include <ndn-cxx/encoding/tlv.hpp>
 #include <ndn-cxx/interest.hpp>
 #include <ndn-cxx/data.hpp>
 #include <ndn-cxx/lp/packet.hpp>
 
-namespace io = boost::iostreams;
 namespace nfdFace = nfd::face;
 
 namespace ns3 {
@@ -69,40 +66,75 @@ BlockHeader::Serialize(ns3::Buffer::Iterator start) const
     start.Write(m_block.wire(), m_block.size());
 }
 
-class Ns3BufferIteratorSource : public io::source {
-  public:
-    Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
-      : m_is(is)
-    {
+namespace {
+
+/**
+ * \brief Maximum size of TLV-TYPE and TLV-LENGTH, each encoded as VAR-NUMBER of up to 9 octets
+ */
+const uint32_t MAX_TL_SIZE = 18;
+
+/**
+ * \brief Get the total size of the TLV block that starts with \p tl
+ * \param tl the first (up to MAX_TL_SIZE) octets of the block
+ * \param tlSize number of octets in \p tl
+ * \param available number of octets available for the whole block
+ * \throw ::ndn::tlv::Error TLV-TYPE or TLV-LENGTH is malformed, or the block is truncated
+ */
+size_t
+getBlockSize(const uint8_t* tl, size_t tlSize, size_t available)
+{
+    const uint8_t* pos = tl;
+    const uint8_t* end = tl + tlSize;
+
+    uint32_t type = 0;
+    if (!::ndn::tlv::readType(pos, end, type)) {
+        throw ::ndn::tlv::Error("Malformed TLV-TYPE");
     }
 
-    std::streamsize
-    read(char* buf, std::streamsize nMaxRead)
-    {
-        std::streamsize i = 0;
-        for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
-            buf[i] = m_is.ReadU8();
-        }
-        if (i == 0) {
-            return -1;
-        }
-        else {
-            return i;
-        }
+    uint64_t length = 0;
+    if (!::ndn::tlv::readVarNumber(pos, end, length)) {
+        throw ::ndn::tlv::Error("Malformed TLV-LENGTH");
+    }
+
+    size_t tlLength = static_cast<size_t>(pos - tl);
+    if (length > available - tlLength) {
+        throw ::ndn::tlv::Error("Not enough bytes in the packet to fully parse TLV");
     }
+    return tlLength + static_cast<size_t>(length);
+}
 
-  private:
-    ns3::Buffer::Iterator& m_is;
-};
+} // namespace
 
 uint32_t
 BlockHeader::Deserialize(ns3::Buffer::Iterator start)
 {
-    io::stream<Ns3BufferIteratorSource> is(start);
-    m_block = ::ndn::Block::fromStream(is);
+    uint8_t tl[MAX_TL_SIZE];
+    uint32_t available = start.GetRemainingSize();
+    uint32_t tlSize = std::min(MAX_TL_SIZE, available);
+
+    ns3::Buffer::Iterator i = start;
+    i.Read(tl, tlSize);
+
+    auto buffer = make_shared<::ndn::Buffer>(getBlockSize(tl, tlSize, available));
+    start.Read(buffer->data(), buffer->size());
+
+    m_block = Block(std::move(buffer));
     return m_block.size();
 }
 
+Block
+BlockHeader::fromPacket(const ns3::Packet& packet)
+{
+    uint8_t tl[MAX_TL_SIZE];
+    uint32_t available = packet.GetSize();
+    uint32_t tlSize = packet.CopyData(tl, std::min(MAX_TL_SIZE, available));
+
+    auto buffer = make_shared<::ndn::Buffer>(getBlockSize(tl, tlSize, available));
+    packet.CopyData(buffer->data(), buffer->size());
+
+    return Block(std::move(buffer));
+}
+
 void
 BlockHeader::Print(std::ostream& os) const
 {
@@ -21,6 +21,7 @@
 #define NDNSIM_NDN_BLOCK_HEADER_HPP
 
 #include "ns3/header.h"
+#include "ns3/packet.h"
 
 #include "ndn-common.hpp"
 
@@ -47,6 +48,19 @@ class BlockHeader : public Header {
 
     virtual void Print(std::ostream& os) const;
 
+    /**
+     * \brief Decode the NDN packet carried by \p packet
+     *
+     * Unlike RemoveHeader/PeekHeader, TLV-TYPE and TLV-LENGTH are read directly from the
+     * packet buffer and the block is then copied into a single ::ndn::Buffer in one bulk
+     * operation.  The ns-3 packet itself is left untouched, so there is no need to Copy() it.
+     * Any trailing bytes after the block (e.g., L2 padding) are ignored.
+     *
+     * \throw ::ndn::tlv::Error the packet does not start with a complete TLV block
+     */
+    static Block
+    fromPacket(const ns3::Packet& packet);
+
     Block& getBlock();
 
     const Block& getBlock() const;
@@ -24,12 +24,14 @@
 #include "ns3/log.h"
 #include "ns3/callback.h"
 #include "ns3/uinteger.h"
+#include "ns3/boolean.h"
 #include "ns3/trace-source-accessor.h"
 #include "ns3/object-vector.h"
 #include "ns3/pointer.h"
 #include "ns3/simulator.h"
 
 #include "ndn-net-device-transport.hpp"
+#include "ndn-app-delivery-queue.hpp"
 
 #include "../helper/ndn-stack-helper.hpp"
 
@@ -76,6 +78,17 @@ L3Protocol::GetTypeId(void)
         .SetParent<Object>()
         .AddConstructor<L3Protocol>()
 
+        .AddAttribute("DirectAppDelivery",
+                      "Deliver packets to applications right after the forwarder returns instead of "
+                      "scheduling a separate event for every packet",
+                      BooleanValue(false), MakeBooleanAccessor(&L3Protocol::m_directAppDelivery),
+                      MakeBooleanChecker())
+        .AddAttribute("SingleCopyPointToPoint",
+                      "Hand the encoded packet to the NetDeviceTransport on the other end of a "
+                      "point-to-point link, instead of decoding it again from the ns-3 packet",
+                      BooleanValue(false), MakeBooleanAccessor(&L3Protocol::m_singleCopyPointToPoint),
+                      MakeBooleanChecker())
+
         .AddTraceSource("OutInterests", "OutInterests", MakeTraceSourceAccessor(&L3Protocol::m_outInterests),
                         "ns3::ndn::L3Protocol::InterestTraceCallback")
         .AddTraceSource("InInterests", "InInterests", MakeTraceSourceAccessor(&L3Protocol::m_inInterests),
@@ -109,58 +122,72 @@ L3Protocol::GetTypeId(void)
 class L3Protocol::Impl {
   private:
     Impl()
+      : m_config(getDefaultConfig())
+    {
+    }
+
+    /**
+     * \brief Parsed initial config, shared by all nodes until one of them modifies its config
+     */
+    static const shared_ptr<nfd::ConfigSection>&
+    getDefaultConfig()
     {
-		// 这里是初始化的配置文件,里面都是默认值,不要去更改它.如果要改的话通过helpers去设置特定的NFD参数
-        // Do not modify initial config file. Use helpers to set specific NFD parameters
-        std::string initialConfig = "general\n"
-                                    "{\n"
-                                    "}\n"
-                                    "\n"
-                                    "tables\n"
-                                    "{\n"
-                                    "  cs_max_packets 100\n"
-                                    "\n"
-                                    "  strategy_choice\n"
-                                    "  {\n"
-                                    "    /               /localhost/nfd/strategy/best-route\n"
-                                    "    /localhost      /localhost/nfd/strategy/multicast\n"
-                                    "    /localhost/nfd  /localhost/nfd/strategy/best-route\n"
-                                    "    /ndn/multicast  /localhost/nfd/strategy/multicast\n"
-                                    "  }\n"
-                                    "}\n"
-                                    "\n"
-                                    // "face_system\n"
-                                    // "{\n"
-                                    // "}\n"
-                                    "\n"
-                                    "authorizations\n"
-                                    "{\n"
-                                    "  authorize\n"
-                                    "  {\n"
-                                    "    certfile any\n"
-                                    "    privileges\n"
-                                    "    {\n"
-                                    "      faces\n"
-                                    "      fib\n"
-                                    "      strategy-choice\n"
-                                    "    }\n"
-                                    "  }\n"
-                                    "}\n"
-                                    "\n"
-                                    "rib\n"
-                                    "{\n"
-                                    "  localhost_security\n"
-                                    "  {\n"
-                                    "    trust-anchor\n"
-                                    "    {\n"
-                                    "      type any\n"
-                                    "    }\n"
-                                    "  }\n"
-                                    "}\n"
-                                    "\n";
-
-        std::istringstream input(initialConfig);
-        boost::property_tree::read_info(input, m_config);
+        static const shared_ptr<nfd::ConfigSection> config = [] {
+			// 这里是初始化的配置文件,里面都是默认值,不要去更改它.如果要改的话通过helpers去设置特定的NFD参数
+            // Do not modify initial config file. Use helpers to set specific NFD parameters
+            std::string initialConfig = "general\n"
+                                        "{\n"
+                                        "}\n"
+                                        "\n"
+                                        "tables\n"
+                                        "{\n"
+                                        "  cs_max_packets 100\n"
+                                        "\n"
+                                        "  strategy_choice\n"
+                                        "  {\n"
+                                        "    /               /localhost/nfd/strategy/best-route\n"
+                                        "    /localhost      /localhost/nfd/strategy/multicast\n"
+                                        "    /localhost/nfd  /localhost/nfd/strategy/best-route\n"
+                                        "    /ndn/multicast  /localhost/nfd/strategy/multicast\n"
+                                        "  }\n"
+                                        "}\n"
+                                        "\n"
+                                        // "face_system\n"
+                                        // "{\n"
+                                        // "}\n"
+                                        "\n"
+                                        "authorizations\n"
+                                        "{\n"
+                                        "  authorize\n"
+                                        "  {\n"
+                                        "    certfile any\n"
+                                        "    privileges\n"
+                                        "    {\n"
+                                        "      faces\n"
+                                        "      fib\n"
+                                        "      strategy-choice\n"
+                                        "    }\n"
+                                        "  }\n"
+                                        "}\n"
+                                        "\n"
+                                        "rib\n"
+                                        "{\n"
+                                        "  localhost_security\n"
+                                        "  {\n"
+                                        "    trust-anchor\n"
+                                        "    {\n"
+                                        "      type any\n"
+                                        "    }\n"
+                                        "  }\n"
+                                        "}\n"
+                                        "\n";
+
+            auto config = make_shared<nfd::ConfigSection>();
+            std::istringstream input(initialConfig);
+            boost::property_tree::read_info(input, *config);
+            return config;
+        }();
+        return config;
     }
 
     friend class L3Protocol;
@@ -188,13 +215,21 @@ class L3Protocol::Impl {
     std::shared_ptr<::ndn::Face> m_internalRibClientFace;
     std::unique_ptr<::nfd::rib::Service> m_ribService;
 
-    nfd::ConfigSection m_config;
+    // copy-on-write: shared with other nodes (and the StackHelper) while use_count() > 1
+    shared_ptr<nfd::ConfigSection> m_config;
 
     PolicyCreationCallback m_policy; // nfd::cs::Policy
+    DecisionPolicyCreationCallback m_decisionPolicy; // nfd::cs::DecisionPolicy
+
+    std::unique_ptr<AppDeliveryQueue> m_appDeliveryQueue;
+
+    bool m_isDataPlaneOnly = false;
 };
 
 L3Protocol::L3Protocol()
   : m_impl(new Impl())
+  , m_directAppDelivery(false)
+  , m_singleCopyPointToPoint(false)
 {
     NS_LOG_FUNCTION(this);
 }
@@ -212,10 +247,17 @@ L3Protocol::initialize()
 
 	// 这里调用Forwarder的构造函数 --> Cs作为它的对象成员调用自己的默认构造 
     m_impl->m_forwarder = make_shared<::nfd::Forwarder>(*m_impl->m_faceTable);
-    m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
 
-    initializeManagement();
-    initializeRibManager();
+    m_impl->m_isDataPlaneOnly = m_impl->m_config->get<bool>("ndnSIM.data_plane_only", false);
+    if (m_impl->m_isDataPlaneOnly) {
+        initializeDataPlane();
+    }
+    else {
+        m_impl->m_faceSystem = make_unique<::nfd::face::FaceSystem>(*m_impl->m_faceTable, nullptr);
+
+        initializeManagement();
+        initializeRibManager();
+    }
 
     m_impl->m_forwarder->beforeSatisfyInterest.connect(std::ref(m_satisfiedInterests));
     m_impl->m_forwarder->beforeExpirePendingInterest.connect(std::ref(m_timedOutInterests));
@@ -247,15 +289,41 @@ class IgnoreSections {
 void
 L3Protocol::injectInterest(const Interest& interest)
 {
+    NS_ASSERT_MSG(!m_impl->m_isDataPlaneOnly, "Cannot inject Interests on a data-plane-only node");
     m_impl->m_internalClientFaceForInjects->expressInterest(interest, nullptr, nullptr, nullptr);
 }
 
+bool
+L3Protocol::isSingleCopyPointToPoint() const
+{
+    return m_singleCopyPointToPoint;
+}
+
+AppDeliveryQueue*
+L3Protocol::getAppDeliveryQueue()
+{
+    if (!m_directAppDelivery) {
+        return nullptr;
+    }
+
+    if (m_impl->m_appDeliveryQueue == nullptr) {
+        m_impl->m_appDeliveryQueue = make_unique<AppDeliveryQueue>();
+    }
+    return m_impl->m_appDeliveryQueue.get();
+}
+
 void
 L3Protocol::setCsReplacementPolicy(const PolicyCreationCallback& policy)
 {
     m_impl->m_policy = policy;
 }
 
+void
+L3Protocol::setCsDecisionPolicy(const DecisionPolicyCreationCallback& policy)
+{
+    m_impl->m_decisionPolicy = policy;
+}
+
 void
 L3Protocol::initializeManagement()
 {
@@ -273,7 +341,7 @@ L3Protocol::initializeManagement()
       make_unique<::ndn::mgmt::Dispatcher>(*m_impl->m_internalClientFace, StackHelper::getKeyChain());
     m_impl->m_authenticator = ::nfd::CommandAuthenticator::create();
 
-    if (!this->getConfig().get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
+    if (!m_impl->m_config->get<bool>("ndnSIM.disable_forwarder_status_manager", false)) {
         m_impl->m_forwarderStatusManager =
           make_unique<::nfd::ForwarderStatusManager>(*m_impl->m_forwarder, *m_impl->m_dispatcher);
     }
@@ -288,11 +356,12 @@ L3Protocol::initializeManagement()
       make_unique<::nfd::CsManager>(m_impl->m_forwarder->getCs(), m_impl->m_forwarder->getCounters(),
                                     *m_impl->m_dispatcher, *m_impl->m_authenticator);
 
-    if (!this->getConfig().get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
+    if (!m_impl->m_config->get<bool>("ndnSIM.disable_strategy_choice_manager", false)) {
         m_impl->m_strategyChoiceManager =
           make_unique<::nfd::StrategyChoiceManager>(m_impl->m_forwarder->getStrategyChoice(), *m_impl->m_dispatcher,
                                                     *m_impl->m_authenticator);
-    } else {
+    } else if (m_impl->m_config->get_child("authorizations.authorize.privileges").count("strategy-choice") > 0) {
+        // StackHelper removes it from the shared config already, so that nodes do not copy it here
         this->getConfig()
           .get_child("authorizations")
           .get_child("authorize")
@@ -303,6 +372,9 @@ L3Protocol::initializeManagement()
     ConfigFile config(&ConfigFile::ignoreUnknownSection);
 
     forwarder->getCs().setPolicy(m_impl->m_policy());
+    if (m_impl->m_decisionPolicy) {
+        forwarder->getCs().setDecisionPolicy(m_impl->m_decisionPolicy());
+    }
 
 	// 这里执行所有table相关设置: 包括CS等
     TablesConfigSection tablesConfig(*forwarder);
@@ -315,7 +387,7 @@ L3Protocol::initializeManagement()
     // }
 
     // apply config
-    config.parse(m_impl->m_config, false, "ndnSIM.conf"); // 配置文件名,这个文件名在前面哪里指定的? TODO
+    config.parse(*m_impl->m_config, false, "ndnSIM.conf"); // 配置文件名,这个文件名在前面哪里指定的? TODO
 
     tablesConfig.ensureConfigured();
 
@@ -336,10 +408,35 @@ L3Protocol::initializeRibManager()
       face::makeInternalFace(StackHelper::getKeyChain());
     m_impl->m_faceTable->add(m_impl->m_internalRibFace);
 
-    m_impl->m_ribService = make_unique<rib::Service>(m_impl->m_config, std::ref(*m_impl->m_internalRibClientFace),
+    m_impl->m_ribService = make_unique<rib::Service>(*m_impl->m_config, std::ref(*m_impl->m_internalRibClientFace),
                                                      std::ref(StackHelper::getKeyChain()));
 }
 
+void
+L3Protocol::initializeDataPlane()
+{
+    using namespace nfd;
+    auto& forwarder = m_impl->m_forwarder;
+
+    forwarder->getCs().setPolicy(m_impl->m_policy());
+    if (m_impl->m_decisionPolicy) {
+        forwarder->getCs().setDecisionPolicy(m_impl->m_decisionPolicy());
+    }
+
+    // 只处理 tables 段 (CS 容量, 默认策略等), 其余段属于管理模块, 这里不会创建
+    ConfigFile config(&ConfigFile::ignoreUnknownSection);
+    TablesConfigSection tablesConfig(*forwarder);
+    tablesConfig.setConfigFile(config);
+    config.parse(*m_impl->m_config, false, "ndnSIM.conf");
+    tablesConfig.ensureConfigured();
+}
+
+bool
+L3Protocol::isDataPlaneOnly() const
+{
+    return m_impl->m_isDataPlaneOnly;
+}
+
 shared_ptr<nfd::Forwarder>
 L3Protocol::getForwarder()
 {
@@ -373,7 +470,17 @@ L3Protocol::getRibService()
 nfd::ConfigSection&
 L3Protocol::getConfig()
 {
-    return m_impl->m_config;
+    if (m_impl->m_config.use_count() > 1) {
+        m_impl->m_config = make_shared<nfd::ConfigSection>(*m_impl->m_config);
+    }
+    return *m_impl->m_config;
+}
+
+void
+L3Protocol::setSharedConfig(shared_ptr<nfd::ConfigSection> config)
+{
+    NS_ASSERT_MSG(m_node == nullptr, "NFD config must be set before L3Protocol is aggregated to a node");
+    m_impl->m_config = std::move(config);
 }
 
 /*
@@ -43,6 +43,7 @@ class Entry;
 } // namespace pit
 namespace cs {
 class Policy;
+class DecisionPolicy;
 } // namespace cs
 
 namespace rib {
@@ -58,6 +59,8 @@ class Header;
 
 namespace ndn {
 
+class AppDeliveryQueue;
+
 /**
  * \defgroup ndn ndnSIM: NDN simulation module
  *
@@ -118,6 +121,12 @@ class L3Protocol : boost::noncopyable, public Object {
 
     ::nfd::rib::Service& getRibService();
 
+    /**
+     * \brief Check whether only Forwarder and FaceTable were created on the node
+     * \see StackHelper::setDataPlaneOnly
+     */
+    bool isDataPlaneOnly() const;
+
     /**
      * \brief Add face to NDN stack
      *
@@ -148,9 +157,20 @@ class L3Protocol : boost::noncopyable, public Object {
 
     /**
      * \brief Get NFD config (boost::property_tree)
+     *
+     * If the config is shared with other nodes, the node gets its own copy first.
      */
     nfd::ConfigSection& getConfig();
 
+    /**
+     * \brief Use NFD config shared with other nodes
+     *
+     * The config is not copied: the node reads it in place and copies it only if modified through
+     * getConfig(). The caller must not modify \p config after passing it. Must be called before
+     * L3Protocol is aggregated to a node.
+     */
+    void setSharedConfig(shared_ptr<nfd::ConfigSection> config);
+
     /**
      * \brief Inject interest through internal Face
      */
@@ -163,6 +183,28 @@ class L3Protocol : boost::noncopyable, public Object {
      */
     void setCsReplacementPolicy(const PolicyCreationCallback& policy);
 
+    typedef std::function<std::unique_ptr<nfd::cs::DecisionPolicy>()> DecisionPolicyCreationCallback;
+
+    /**
+     * \brief Set the cache decision policy of NFD's CS
+     */
+    void setCsDecisionPolicy(const DecisionPolicyCreationCallback& policy);
+
+    /**
+     * \brief Get queue used to deliver packets to applications without a separate event per packet
+     *
+     * \return nullptr unless DirectAppDelivery attribute is enabled
+     * \see AppDeliveryQueue
+     */
+    AppDeliveryQueue* getAppDeliveryQueue();
+
+    /**
+     * \brief Whether NetDeviceTransport passes sent blocks directly to the peer transport
+     *
+     * \return value of SingleCopyPointToPoint attribute
+     */
+    bool isSingleCopyPointToPoint() const;
+
   public: // Workaround for python bindings
     static Ptr<L3Protocol> getL3Protocol(Ptr<Object> node);
 
@@ -191,6 +233,8 @@ class L3Protocol : boost::noncopyable, public Object {
 
     void initializeRibManager();
 
+    void initializeDataPlane();
+
   private:
     class Impl;
     std::unique_ptr<Impl> m_impl;
@@ -198,6 +242,9 @@ class L3Protocol : boost::noncopyable, public Object {
     // These objects are aggregated, but for optimization, get them here
     Ptr<Node> m_node; ///< \brief node on which ndn stack is installed
 
+    bool m_directAppDelivery; ///< \brief deliver packets to applications via AppDeliveryQueue
+    bool m_singleCopyPointToPoint; ///< \brief share sent blocks with the peer NetDeviceTransport
+
     TracedCallback<const Interest&, const Face&> m_inInterests;  ///< @brief trace of incoming Interests
     TracedCallback<const Interest&, const Face&> m_outInterests; ///< @brief Transmitted interests trace
 
@@ -21,6 +21,7 @@
 
 #include "../helper/ndn-stack-helper.hpp"
 #include "ndn-block-header.hpp"
+#include "ndn-app-delivery-queue.hpp"
 #include "../utils/ndn-ns3-packet-tag.hpp"
 
 #include <ndn-cxx/encoding/block.hpp>
@@ -34,11 +35,19 @@ NS_LOG_COMPONENT_DEFINE("ndn.NetDeviceTransport");
 namespace ns3 {
 namespace ndn {
 
+/**
+ * \brief Maximum number of blocks waiting for the peer; older packets are decoded from the bytes
+ */
+static const size_t MAX_SHARED_BLOCKS = 4096;
+
 NetDeviceTransport::NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& netDevice, const std::string& localUri,
                                        const std::string& remoteUri, ::ndn::nfd::FaceScope scope,
                                        ::ndn::nfd::FacePersistency persistency, ::ndn::nfd::LinkType linkType)
   : m_netDevice(netDevice)
   , m_node(node)
+  , m_appDeliveryQueue(nullptr)
+  , m_peerTransport(nullptr)
+  , m_nReceivedSharedBlocks(0)
 {
     this->setLocalUri(FaceUri(localUri));
     this->setRemoteUri(FaceUri(remoteUri));
@@ -48,12 +57,16 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& net
     this->setMtu(m_netDevice->GetMtu()); // Use the MTU of the netDevice
 
     // Get send queue capacity for congestion marking
+    // 只在构造时查一次属性, 之后 getSendQueueLength 直接读取队列的字节计数
     PointerValue txQueueAttribute;
     if (m_netDevice->GetAttributeFailSafe("TxQueue", txQueueAttribute)) {
-        Ptr<ns3::QueueBase> txQueue = txQueueAttribute.Get<ns3::QueueBase>();
+        m_txQueue = txQueueAttribute.Get<ns3::QueueBase>();
+    }
+
+    if (m_txQueue != 0) {
         // must be put into bytes mode queue
 
-        auto size = txQueue->GetMaxSize();
+        auto size = m_txQueue->GetMaxSize();
         if (size.GetUnit() == BYTES) {
             this->setSendQueueCapacity(size.GetValue());
         }
@@ -67,6 +80,18 @@ NetDeviceTransport::NetDeviceTransport(Ptr<Node> node, const Ptr<NetDevice>& net
 
     NS_ASSERT_MSG(m_netDevice != 0, "NetDeviceFace needs to be assigned a valid NetDevice");
 
+    Ptr<L3Protocol> ndn = m_node->GetObject<L3Protocol>();
+    if (ndn != 0) {
+        m_appDeliveryQueue = ndn->getAppDeliveryQueue();
+
+        // 点对点链路: 记下对端设备, 发送时把已编码的 Block 直接交给对端 transport
+        Ptr<Channel> channel = m_netDevice->GetChannel();
+        if (ndn->isSingleCopyPointToPoint() && DynamicCast<PointToPointNetDevice>(m_netDevice) != 0 && channel != 0 &&
+            channel->GetNDevices() == 2) {
+            m_peerNetDevice = channel->GetDevice(channel->GetDevice(0) == m_netDevice ? 1 : 0);
+        }
+    }
+
     // Node::ReceiveFromDevice ---> NetDeviceTransport::receiveFromNetDevice
     m_node->RegisterProtocolHandler(MakeCallback(&NetDeviceTransport::receiveFromNetDevice, this),
                                     L3Protocol::ETHERNET_FRAME_TYPE, m_netDevice, true /*promiscuous mode*/);
@@ -80,10 +105,8 @@ NetDeviceTransport::~NetDeviceTransport()
 ssize_t
 NetDeviceTransport::getSendQueueLength()
 {
-    PointerValue txQueueAttribute;
-    if (m_netDevice->GetAttributeFailSafe("TxQueue", txQueueAttribute)) {
-        Ptr<ns3::QueueBase> txQueue = txQueueAttribute.Get<ns3::QueueBase>();
-        return txQueue->GetNBytes();
+    if (m_txQueue != 0) {
+        return m_txQueue->GetNBytes();
     }
     else {
         return nfd::face::QUEUE_UNSUPPORTED;
@@ -111,6 +134,19 @@ NetDeviceTransport::doSend(const Block& packet, const nfd::EndpointId& endpoint)
     Ptr<ns3::Packet> ns3Packet = Create<ns3::Packet>();
     ns3Packet->AddHeader(header);
 
+    // the bytes stay in the ns-3 packet for pcap, error models and the queues; the peer only
+    // skips decoding them
+    if (m_peerNetDevice != 0) {
+        NetDeviceTransport* peer = getPeerTransport();
+        if (peer != nullptr) {
+            if (peer->m_sharedBlocks.size() >= MAX_SHARED_BLOCKS) {
+                // the peer does not receive anything (e.g., failed link), do not keep the blocks alive
+                peer->m_sharedBlocks.pop_front();
+            }
+            peer->m_sharedBlocks.emplace_back(ns3Packet->GetUid(), packet);
+        }
+    }
+
     // send the NS3 packet
     // TODO: 在这里之后的代码跳转和教程里介绍的不一致???
     m_netDevice->Send(ns3Packet, m_netDevice->GetBroadcast(), L3Protocol::ETHERNET_FRAME_TYPE);
@@ -123,14 +159,60 @@ NetDeviceTransport::receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const ns3::P
 {
     NS_LOG_FUNCTION(device << p << protocol << from << to << packetType);
 
-    // Convert NS3 packet to NFD packet
-    Ptr<ns3::Packet> packet = p->Copy();
+    // Convert NS3 packet to NFD packet: the block is copied straight out of the (const) ns-3
+    // packet buffer, so neither Packet::Copy() nor RemoveHeader() is needed
+    // 转发过程中发往本节点应用的包在 guard 析构时直接分发, 不再各自占用一个事件
+    AppDeliveryQueue::Guard guard(m_appDeliveryQueue);
+    Block block;
+    if (takeSharedBlock(*p, block)) {
+        this->receive(block);
+        return;
+    }
+    this->receive(BlockHeader::fromPacket(*p));
+}
 
-    // 去掉packet的header,转化为Block类型准备向上传
-    BlockHeader header;
-    packet->RemoveHeader(header);
+NetDeviceTransport*
+NetDeviceTransport::getPeerTransport()
+{
+    if (!m_peerFace.expired()) {
+        return m_peerTransport;
+    }
+
+    Ptr<L3Protocol> peerNdn = m_peerNetDevice->GetNode()->GetObject<L3Protocol>();
+    if (peerNdn == 0) {
+        return nullptr;
+    }
+    shared_ptr<Face> peerFace = peerNdn->getFaceByNetDevice(m_peerNetDevice);
+    if (peerFace == nullptr) {
+        return nullptr;
+    }
+
+    // the peer face may use another transport (e.g., installed by a custom face factory), in which
+    // case blocks are not shared and the peer decodes the packet as usual
+    m_peerFace = peerFace;
+    m_peerTransport = dynamic_cast<NetDeviceTransport*>(peerFace->getTransport());
+    return m_peerTransport;
+}
 
-    this->receive(std::move(header.getBlock()));
+bool
+NetDeviceTransport::takeSharedBlock(const ns3::Packet& p, Block& block)
+{
+    uint64_t uid = p.GetUid();
+    while (!m_sharedBlocks.empty() && m_sharedBlocks.front().first < uid) {
+        m_sharedBlocks.pop_front(); // dropped by the queue or the error model
+    }
+
+    if (m_sharedBlocks.empty() || m_sharedBlocks.front().first != uid) {
+        return false;
+    }
+
+    bool isSame = m_sharedBlocks.front().second.size() == p.GetSize();
+    if (isSame) {
+        block = std::move(m_sharedBlocks.front().second);
+        ++m_nReceivedSharedBlocks;
+    }
+    m_sharedBlocks.pop_front();
+    return isSame;
 }
 
 Ptr<NetDevice>
@@ -32,9 +32,16 @@
 #include "ns3/point-to-point-net-device.h"
 #include "ns3/channel.h"
 
+#include <deque>
+
 namespace ns3 {
+
+class QueueBase;
+
 namespace ndn {
 
+class AppDeliveryQueue;
+
 /**
  * \ingroup ndn-face
  * \brief ndnSIM-specific transport
@@ -52,6 +59,16 @@ class NetDeviceTransport : public nfd::face::Transport {
 
     virtual ssize_t getSendQueueLength() final;
 
+    /**
+     * \brief Number of received packets taken from blocks shared by the peer transport
+     * \sa L3Protocol::isSingleCopyPointToPoint
+     */
+    uint64_t
+    getNReceivedSharedBlocks() const
+    {
+        return m_nReceivedSharedBlocks;
+    }
+
   private:
     virtual void doClose() override;
 
@@ -60,8 +77,39 @@ class NetDeviceTransport : public nfd::face::Transport {
     void receiveFromNetDevice(Ptr<NetDevice> device, Ptr<const ns3::Packet> p, uint16_t protocol, const Address& from,
                               const Address& to, NetDevice::PacketType packetType);
 
+    /**
+     * \brief Find the transport on the other end of the point-to-point link
+     * \return nullptr if there is none (yet)
+     */
+    NetDeviceTransport* getPeerTransport();
+
+    /**
+     * \brief Take the block shared by the peer transport for packet \p p, if any
+     */
+    bool takeSharedBlock(const ns3::Packet& p, Block& block);
+
     Ptr<NetDevice> m_netDevice; ///< \brief Smart pointer to NetDevice
     Ptr<Node> m_node;
+    Ptr<QueueBase> m_txQueue; ///< \brief TxQueue of the NetDevice, null if it has none
+    AppDeliveryQueue* m_appDeliveryQueue; ///< \brief nullptr unless L3Protocol::DirectAppDelivery
+
+    Ptr<NetDevice> m_peerNetDevice; ///< \brief other end of the link, null unless SingleCopyPointToPoint
+    std::weak_ptr<nfd::face::Face> m_peerFace;
+    /**
+     * \brief Transport of m_peerFace, valid while m_peerFace is not expired
+     *
+     * Null if the peer face does not use a NetDeviceTransport.
+     */
+    NetDeviceTransport* m_peerTransport;
+
+    /**
+     * \brief Blocks sent by the peer transport, keyed by uid of the ns-3 packet carrying them
+     *
+     * A point-to-point link delivers packets in the order they were sent, so uids are increasing
+     * and entries of packets lost on the link are skipped by the next received packet.
+     */
+    std::deque<std::pair<uint64_t, Block>> m_sharedBlocks;
+    uint64_t m_nReceivedSharedBlocks;
 };
 
 } // namespace ndn
@@ -37,6 +37,29 @@ class PacketBase : public TagHost {
     /** \brief set the CongestionMark tag to the specified value
      */
     void setCongestionMark(uint64_t mark);
+
+    /** \brief get the hop-by-hop cache decision state
+     *
+     *  The state is interpreted by the cache decision policy of the forwarder (e.g., LCD sets it
+     *  once a copy has been cached upstream) and is carried between nodes in the NDNLP header.
+     *  Unlike a packet tag, reading and updating it does not allocate.
+     */
+    uint64_t
+    getCacheDecisionState() const
+    {
+        return m_cacheDecisionState;
+    }
+
+    /** \brief set the hop-by-hop cache decision state
+     */
+    void
+    setCacheDecisionState(uint64_t state) const
+    {
+        m_cacheDecisionState = state;
+    }
+
+  private:
+    mutable uint64_t m_cacheDecisionState = 0;
 };
 
 } // namespace ndn
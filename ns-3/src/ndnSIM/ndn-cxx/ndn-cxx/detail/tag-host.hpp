@@ -25,11 +25,15 @@
 #include "ndn-cxx/detail/common.hpp"
 #include "ndn-cxx/tag.hpp"
 
-#include <map>
+#include <array>
+#include <vector>
 
 namespace ndn {
 
 /** \brief Base class to store tag information (e.g., inside Interest and Data packets)
+ *
+ *  A packet carries only a few tags at a time, so the first tags are kept in a small inline
+ *  array that is scanned linearly; setting them does not allocate. Further tags go to a vector.
  */
 class TagHost {
   public:
@@ -53,21 +57,70 @@ class TagHost {
     template <typename T>
     void removeTag() const;
 
-	// chaochao
-	// void getAllTags() const; 
-
   private:
-    mutable std::map<int, shared_ptr<Tag>> m_tags;
-	// 它只负责提供方法, 不指定你如何设置, 或者设置哪些
+    struct Item {
+        int type = 0;
+        shared_ptr<Tag> tag; // nullptr: unused inline item
+    };
+
+    Item* findItem(int type) const;
+
+    void setItem(int type, shared_ptr<Tag> tag) const;
+
+    // 大多数包一跳上只带 IncomingFaceId/HopCount 等少数几个 tag
+    static constexpr size_t N_INLINE_TAGS = 3;
 
+    mutable std::array<Item, N_INLINE_TAGS> m_inlineTags;
+    mutable std::vector<Item> m_moreTags; // every item holds a tag
 };
 
-// 不能自定义成员函数??? 报错multiple definition???
-// void 
-// TagHost::getAllTags() const
-// {
-// 	// std::cout << "CS match data with Tags: " << m_tags.size() << std::endl;
-// }
+inline TagHost::Item*
+TagHost::findItem(int type) const
+{
+    for (Item& item : m_inlineTags) {
+        if (item.type == type && item.tag != nullptr) {
+            return &item;
+        }
+    }
+    for (Item& item : m_moreTags) {
+        if (item.type == type) {
+            return &item;
+        }
+    }
+    return nullptr;
+}
+
+inline void
+TagHost::setItem(int type, shared_ptr<Tag> tag) const
+{
+    Item* item = findItem(type);
+    if (tag == nullptr) {
+        if (item == nullptr) {
+            return;
+        }
+        if (item >= m_inlineTags.data() && item < m_inlineTags.data() + N_INLINE_TAGS) {
+            item->tag = nullptr;
+        }
+        else {
+            std::swap(*item, m_moreTags.back());
+            m_moreTags.pop_back();
+        }
+        return;
+    }
+
+    if (item != nullptr) {
+        item->tag = std::move(tag);
+        return;
+    }
+    for (Item& inlineItem : m_inlineTags) {
+        if (inlineItem.tag == nullptr) {
+            inlineItem.type = type;
+            inlineItem.tag = std::move(tag);
+            return;
+        }
+    }
+    m_moreTags.push_back({type, std::move(tag)});
+}
 
 template <typename T>
 shared_ptr<T>
@@ -75,11 +128,11 @@ TagHost::getTag() const
 {
     static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
-    auto it = m_tags.find(T::getTypeId());
-    if (it == m_tags.end()) {
+    Item* item = findItem(T::getTypeId());
+    if (item == nullptr) {
         return nullptr;
     }
-    return static_pointer_cast<T>(it->second);
+    return static_pointer_cast<T>(item->tag);
 }
 
 template <typename T>
@@ -88,12 +141,7 @@ TagHost::setTag(shared_ptr<T> tag) const
 {
     static_assert(std::is_base_of<Tag, T>::value, "T must inherit from Tag");
 
-    if (tag == nullptr) {
-        m_tags.erase(T::getTypeId());
-    }
-    else {
-        m_tags[T::getTypeId()] = std::move(tag);
-    }
+    setItem(T::getTypeId(), std::move(tag));
 }
 
 template <typename T>
@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#include "ndn-cxx/encoding/zero-buffer.hpp"
+
+#include <cstring>
+#include <map>
+
+namespace ndn {
+
+ConstBufferPtr
+getZeroBuffer(size_t size)
+{
+    // simulations use a handful of payload sizes; bound the cache in case one does not
+    static const size_t MAX_CACHED_SIZES = 64;
+    static std::map<size_t, ConstBufferPtr> buffers;
+
+    if (buffers.size() >= MAX_CACHED_SIZES && buffers.count(size) == 0) {
+        // buffers still in use are kept alive by their holders
+        buffers.clear();
+    }
+
+    auto& buffer = buffers[size];
+    if (buffer == nullptr) {
+        buffer = make_shared<const Buffer>(size);
+    }
+    return buffer;
+}
+
+bool
+isZeroFilled(const uint8_t* buf, size_t size)
+{
+    // compare in word-sized chunks, then the remaining tail
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, buf + i, sizeof(word));
+        if (word != 0) {
+            return false;
+        }
+    }
+    for (; i < size; ++i) {
+        if (buf[i] != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace ndn
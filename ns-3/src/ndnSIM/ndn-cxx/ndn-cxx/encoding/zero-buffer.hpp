@@ -0,0 +1,50 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_ENCODING_ZERO_BUFFER_HPP
+#define NDN_ENCODING_ZERO_BUFFER_HPP
+
+#include "ndn-cxx/encoding/buffer.hpp"
+
+namespace ndn {
+
+/**
+ * @brief Get a shared immutable buffer of @p size zero octets
+ *
+ * Buffers are cached per size, so that all virtual (all-zero) payloads of the same size share
+ * one allocation. At most 64 sizes are cached at a time. This is an ndnSIM extension used by
+ * applications that only model payload length, and by the Content Store to drop such payloads
+ * from stored packets.
+ *
+ * @note Not thread-safe.
+ */
+ConstBufferPtr
+getZeroBuffer(size_t size);
+
+/**
+ * @brief Check whether all @p size octets starting at @p buf are zero
+ */
+bool
+isZeroFilled(const uint8_t* buf, size_t size);
+
+} // namespace ndn
+
+#endif // NDN_ENCODING_ZERO_BUFFER_HPP
@@ -269,7 +269,7 @@ extractLpLocalFields(NetPkt& netPacket, const lp::Packet& lpPacket)
     addTagFromField<lp::CongestionMarkTag, lp::CongestionMarkField>(netPacket, lpPacket);
 
     if (lpPacket.has<lp::HopCountTagField>()) {
-        netPacket.setTag(make_shared<lp::HopCountTag>(lpPacket.get<lp::HopCountTagField>() + 1));
+        netPacket.setTag(makeTag<lp::HopCountTag>(lpPacket.get<lp::HopCountTagField>() + 1));
     }
 }
 
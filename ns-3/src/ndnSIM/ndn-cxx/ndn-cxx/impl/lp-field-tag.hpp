@@ -42,7 +42,7 @@ void
 addTagFromField(Packet& packet, const lp::Packet& lpPacket)
 {
     if (lpPacket.has<Field>()) {
-        packet.setTag(make_shared<Tag>(lpPacket.get<Field>()));
+        packet.setTag(makeTag<Tag>(lpPacket.get<Field>()));
     }
 }
 
@@ -91,7 +91,8 @@ typedef FieldDecl<field_location_tags::Header, uint16_t, tlv::HopCountTag, false
 BOOST_CONCEPT_ASSERT((Field<HopCountTagField>));
 
 // chaochao 的 field ---> 注意下面还要再声明一下!
-typedef FieldDecl<field_location_tags::Header, uint16_t, tlv::ChaoChaoTag, false, NonNegativeIntegerTag,
+// 携带 PacketBase::getCacheDecisionState(), NonNegativeInteger 编码长度与取值有关, 用 uint64_t 不增加线上字节
+typedef FieldDecl<field_location_tags::Header, uint64_t, tlv::ChaoChaoTag, false, NonNegativeIntegerTag,
                   NonNegativeIntegerTag>
   ChaoChaoTagField;
 BOOST_CONCEPT_ASSERT((Field<ChaoChaoTagField>));
@@ -34,8 +34,10 @@ namespace lp {
 /** \brief represents a Network Nack
  *
  *  This type binds a NackHeader and an Interest, and is intended for use in network layer.
+ *  \warning In contexts that use `Nack::shared_from_this()`, such as sending the Nack to an
+ *           application face, Nack must be created using `make_shared`.
  */
-class Nack : public PacketBase {
+class Nack : public PacketBase, public std::enable_shared_from_this<Nack> {
   public:
     Nack();
 
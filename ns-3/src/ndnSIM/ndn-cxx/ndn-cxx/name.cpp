@@ -154,6 +154,7 @@ Name::wireDecode(const Block& wire)
 
     m_wire = wire;
     m_wire.parse();
+    m_prefixHashes.reset();
 }
 
 Name
@@ -211,6 +212,7 @@ Name::set(ssize_t i, const Component& component)
 
     const_cast<Block::element_container&>(m_wire.elements())[i] = component;
     m_wire.resetWire();
+    m_prefixHashes.reset();
     return *this;
 }
 
@@ -223,6 +225,7 @@ Name::set(ssize_t i, Component&& component)
 
     const_cast<Block::element_container&>(m_wire.elements())[i] = std::move(component);
     m_wire.resetWire();
+    m_prefixHashes.reset();
     return *this;
 }
 
@@ -272,12 +275,14 @@ Name::erase(ssize_t i)
     }
 
     m_wire.erase(m_wire.elements_begin() + i);
+    m_prefixHashes.reset();
 }
 
 void
 Name::clear()
 {
     m_wire = Block(tlv::Name);
+    m_prefixHashes.reset();
 }
 
 // ---- algorithms ----
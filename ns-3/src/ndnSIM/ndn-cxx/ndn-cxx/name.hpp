@@ -629,6 +629,34 @@ class Name {
         return os;
     }
 
+  public: // memoized prefix hashes
+    /** @brief Hash values of the prefixes of this name; the i-th value covers the first i components
+     */
+    using PrefixHashes = std::vector<size_t>;
+
+    /** @brief Get the prefix hashes memoized on this name
+     *  @return the memoized sequence, or nullptr if none
+     *
+     *  This cache lets a user that hashes prefixes of the same name repeatedly, such as the NFD
+     *  NameTree, compute them once per name. ndn-cxx does not interpret the values.
+     *  Copies of the name share the cache. Appending components keeps it, because the hashes of
+     *  existing prefixes do not change; any other modification discards it.
+     */
+    const PrefixHashes*
+    getPrefixHashes() const
+    {
+        return m_prefixHashes.get();
+    }
+
+    /** @brief Memoize prefix hashes on this name
+     *  @pre hashes.size() <= size() + 1
+     */
+    void
+    setPrefixHashes(PrefixHashes hashes) const
+    {
+        m_prefixHashes = make_shared<const PrefixHashes>(std::move(hashes));
+    }
+
   public:
     /** @brief Indicates "until the end" in getSubName() and compare().
      */
@@ -636,6 +664,7 @@ class Name {
 
   private:
     mutable Block m_wire;
+    mutable shared_ptr<const PrefixHashes> m_prefixHashes;
 };
 
 NDN_CXX_DECLARE_WIRE_ENCODE_INSTANTIATIONS(Name);
@@ -22,6 +22,8 @@
 #ifndef NDN_TAG_HPP
 #define NDN_TAG_HPP
 
+#include "ndn-cxx/util/pool-allocator.hpp"
+
 namespace ndn {
 
 /**
@@ -87,6 +89,18 @@ class SimpleTag : public Tag {
     T m_value;
 };
 
+/** @brief create a tag to be attached to a packet with TagHost::setTag
+ *
+ *  Equivalent to make_shared<T>(args...), except that the tag is allocated from a pool that
+ *  recycles the tags of destroyed packets. Use it for tags that are set on every packet.
+ */
+template <typename T, typename... Args>
+shared_ptr<T>
+makeTag(Args&&... args)
+{
+    return std::allocate_shared<T>(util::PoolAllocator<T>(), std::forward<Args>(args)...);
+}
+
 } // namespace ndn
 
 #endif // NDN_TAG_HPP
@@ -0,0 +1,159 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2013-2020 Regents of the University of California.
+ *
+ * This file is part of ndn-cxx library (NDN C++ library with eXperimental eXtensions).
+ *
+ * ndn-cxx library is free software: you can redistribute it and/or modify it under the
+ * terms of the GNU Lesser General Public License as published by the Free Software
+ * Foundation, either version 3 of the License, or (at your option) any later version.
+ *
+ * ndn-cxx library is distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS FOR A
+ * PARTICULAR PURPOSE.  See the GNU Lesser General Public License for more details.
+ *
+ * You should have received copies of the GNU General Public License and GNU Lesser
+ * General Public License along with ndn-cxx, e.g., in COPYING.md file.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * See AUTHORS.md for complete list of ndn-cxx authors and contributors.
+ */
+
+#ifndef NDN_UTIL_POOL_ALLOCATOR_HPP
+#define NDN_UTIL_POOL_ALLOCATOR_HPP
+
+#include "ndn-cxx/detail/common.hpp"
+
+#include <boost/noncopyable.hpp>
+
+namespace ndn {
+namespace util {
+
+/** \brief a free list of fixed-size blocks carved out of slabs
+ *
+ *  Objects created and destroyed once per packet, such as PIT entries and packet tags, can reuse
+ *  the blocks of their predecessors. This avoids one malloc/free pair per object and keeps such
+ *  objects close together in memory.
+ *
+ *  There is one pool per block size and thread. Slabs are never returned to the system, so a pool
+ *  holds as many blocks as were ever in use at the same time. Pools are intentionally leaked at
+ *  thread exit, because objects destroyed later may still release their blocks.
+ */
+template<size_t BLOCK_SIZE>
+class FixedSizePool : boost::noncopyable {
+  public:
+    static FixedSizePool&
+    get()
+    {
+        // intentionally leaked: blocks may still be released by objects destroyed at exit
+        static thread_local FixedSizePool* pool = new FixedSizePool;
+        return *pool;
+    }
+
+    void*
+    allocate()
+    {
+        if (m_freeList == nullptr) {
+            this->grow();
+        }
+        Block* block = m_freeList;
+        m_freeList = block->next;
+        return block;
+    }
+
+    void
+    deallocate(void* p) noexcept
+    {
+        Block* block = static_cast<Block*>(p);
+        block->next = m_freeList;
+        m_freeList = block;
+    }
+
+    /** \return number of blocks obtained from the system so far
+     */
+    size_t
+    getCapacity() const
+    {
+        return m_capacity;
+    }
+
+  private:
+    union Block {
+        Block* next;
+        alignas(alignof(std::max_align_t)) unsigned char storage[BLOCK_SIZE];
+    };
+
+    void
+    grow()
+    {
+        // slabs double in size, starting from 64 blocks and capped at 4096 blocks
+        size_t nBlocks = std::min<size_t>(std::max<size_t>(m_capacity, 64), 4096);
+        Block* slab = static_cast<Block*>(::operator new(nBlocks * sizeof(Block)));
+        for (size_t i = nBlocks; i > 0; --i) {
+            slab[i - 1].next = m_freeList;
+            m_freeList = &slab[i - 1];
+        }
+        m_capacity += nBlocks;
+    }
+
+  private:
+    Block* m_freeList = nullptr;
+    size_t m_capacity = 0;
+};
+
+/** \brief a stateless allocator that serves single objects from FixedSizePool
+ *
+ *  Array allocations (n > 1) fall through to the global operator new.
+ */
+template<typename T>
+class PoolAllocator {
+  public:
+    using value_type = T;
+    using Pool = FixedSizePool<sizeof(T)>;
+
+    PoolAllocator() noexcept = default;
+
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) noexcept
+    {
+    }
+
+    T*
+    allocate(size_t n)
+    {
+        static_assert(alignof(T) <= alignof(std::max_align_t), "over-aligned types are not supported");
+        if (n != 1) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(Pool::get().allocate());
+    }
+
+    void
+    deallocate(T* p, size_t n) noexcept
+    {
+        if (n != 1) {
+            ::operator delete(p);
+            return;
+        }
+        Pool::get().deallocate(p);
+    }
+};
+
+template<typename T, typename U>
+bool
+operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return true;
+}
+
+template<typename T, typename U>
+bool
+operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) noexcept
+{
+    return false;
+}
+
+} // namespace util
+} // namespace ndn
+
+#endif // NDN_UTIL_POOL_ALLOCATOR_HPP
@@ -20,6 +20,7 @@
  */
 
 #include "ndn-cxx/util/scheduler.hpp"
+#include "ndn-cxx/util/pool-allocator.hpp"
 
 #include <boost/scope_exit.hpp>
 
@@ -30,9 +31,10 @@ namespace scheduler {
  */
 class EventInfo : noncopyable {
   public:
-    EventInfo(time::nanoseconds after, EventCallback&& cb, uint32_t context)
+    EventInfo(time::nanoseconds after, EventCallback&& cb, uint32_t context, uint64_t sequence)
       : callback(std::move(cb))
       , expireTime(time::steady_clock::now() + after)
+      , sequence(sequence)
       , context(context)
     {
     }
@@ -45,8 +47,9 @@ class EventInfo : noncopyable {
 
   public:
     EventCallback callback;
-    Scheduler::EventQueue::const_iterator queueIt;
     time::steady_clock::TimePoint expireTime;
+    uint64_t sequence;   ///< order of scheduling, breaks ties between equal expireTime
+    size_t heapIndex = 0; ///< position in Scheduler::m_queue
     bool isExpired = false;
     uint32_t context = 0;
 };
@@ -75,12 +78,6 @@ operator<<(std::ostream& os, const EventId& eventId)
     return os << eventId.m_info.lock();
 }
 
-bool
-Scheduler::EventQueueCompare::operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept
-{
-    return a->expireTime < b->expireTime;
-}
-
 Scheduler::Scheduler(DummyIoService& ioService)
 {
 }
@@ -95,15 +92,19 @@ Scheduler::schedule(time::nanoseconds after, EventCallback callback)
 {
     BOOST_ASSERT(callback != nullptr);
 
-    auto i = m_queue.insert(make_shared<EventInfo>(after, std::move(callback), ns3::Simulator::GetContext()));
-    (*i)->queueIt = i;
+    // EventInfo 与 shared_ptr 控制块一起从内存池分配, 每个 PIT 条目的超时定时器都会走这里
+    auto info = std::allocate_shared<EventInfo>(util::PoolAllocator<EventInfo>(), after, std::move(callback),
+                                                ns3::Simulator::GetContext(), m_nextSequence++);
+    info->heapIndex = m_queue.size();
+    m_queue.push_back(info);
+    this->siftUp(info->heapIndex);
 
-    if (!m_isEventExecuting && i == m_queue.begin()) {
+    if (!m_isEventExecuting && info->heapIndex == 0) {
         // the new event is the first one to expire
         this->scheduleNext();
     }
 
-    return EventId(*this, *i);
+    return EventId(*this, info);
 }
 
 void
@@ -113,14 +114,17 @@ Scheduler::cancelImpl(const shared_ptr<EventInfo>& info)
         return;
     }
 
+    BOOST_ASSERT(m_queue.at(info->heapIndex) == info);
+    this->eraseAt(info->heapIndex);
+    ++m_nCanceledEvents;
+
+    // Re-arm the timer even if it would still fire in time: the new ns-3 event is ordered after
+    // ns-3 events already scheduled for the same time, which is the order NFD has always observed.
+    // Remove rather than Cancel: a canceled ns-3 event still advances the simulation clock.
     if (m_timerEvent) {
-        if (!m_timerEvent->IsExpired()) {
-            ns3::Simulator::Remove(*m_timerEvent);
-        }
+        ns3::Simulator::Remove(*m_timerEvent);
         m_timerEvent.reset();
     }
-    m_queue.erase(info->queueIt);
-
     if (!m_isEventExecuting) {
         this->scheduleNext();
     }
@@ -141,10 +145,22 @@ Scheduler::cancelAllEvents()
 void
 Scheduler::scheduleNext()
 {
-    if (!m_queue.empty()) {
-        m_timerEvent = ns3::Simulator::Schedule(ns3::NanoSeconds((*m_queue.begin())->expiresFromNow().count()),
-                                                &Scheduler::executeEvent, this);
+    if (m_queue.empty()) {
+        return;
+    }
+
+    auto expireTime = m_queue.front()->expireTime;
+    if (m_timerEvent) {
+        if (m_timerExpireTime <= expireTime) {
+            // the timer fires no later than the earliest event
+            return;
+        }
+        ns3::Simulator::Remove(*m_timerEvent);
     }
+
+    m_timerExpireTime = expireTime;
+    m_timerEvent = ns3::Simulator::Schedule(ns3::NanoSeconds(m_queue.front()->expiresFromNow().count()),
+                                            &Scheduler::executeEvent, this);
 }
 
 void
@@ -163,13 +179,12 @@ Scheduler::executeEvent()
     // process all expired events
     auto now = time::steady_clock::now();
     while (!m_queue.empty()) {
-        auto head = m_queue.begin();
-        shared_ptr<EventInfo> info = *head;
-        if (info->expireTime > now) {
+        if (m_queue.front()->expireTime > now) {
             break;
         }
 
-        m_queue.erase(head);
+        shared_ptr<EventInfo> info = m_queue.front();
+        this->eraseAt(0);
         info->isExpired = true;
         if (ns3::Simulator::GetContext() == info->context) {
             info->callback();
@@ -180,5 +195,75 @@ Scheduler::executeEvent()
     }
 }
 
+bool
+Scheduler::isBefore(const EventInfo& a, const EventInfo& b) noexcept
+{
+    if (a.expireTime != b.expireTime) {
+        return a.expireTime < b.expireTime;
+    }
+    return a.sequence < b.sequence;
+}
+
+void
+Scheduler::siftUp(size_t index)
+{
+    shared_ptr<EventInfo> info = std::move(m_queue[index]);
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!isBefore(*info, *m_queue[parent])) {
+            break;
+        }
+        m_queue[index] = std::move(m_queue[parent]);
+        m_queue[index]->heapIndex = index;
+        index = parent;
+    }
+    info->heapIndex = index;
+    m_queue[index] = std::move(info);
+}
+
+void
+Scheduler::siftDown(size_t index)
+{
+    shared_ptr<EventInfo> info = std::move(m_queue[index]);
+    size_t size = m_queue.size();
+    while (true) {
+        size_t child = 2 * index + 1;
+        if (child >= size) {
+            break;
+        }
+        if (child + 1 < size && isBefore(*m_queue[child + 1], *m_queue[child])) {
+            ++child;
+        }
+        if (!isBefore(*m_queue[child], *info)) {
+            break;
+        }
+        m_queue[index] = std::move(m_queue[child]);
+        m_queue[index]->heapIndex = index;
+        index = child;
+    }
+    info->heapIndex = index;
+    m_queue[index] = std::move(info);
+}
+
+void
+Scheduler::eraseAt(size_t index)
+{
+    size_t last = m_queue.size() - 1;
+    if (index != last) {
+        m_queue[index] = std::move(m_queue[last]);
+        m_queue[index]->heapIndex = index;
+    }
+    m_queue.pop_back();
+
+    if (index < m_queue.size()) {
+        if (index > 0 && isBefore(*m_queue[index], *m_queue[(index - 1) / 2])) {
+            this->siftUp(index);
+        }
+        else {
+            this->siftDown(index);
+        }
+    }
+}
+
 } // namespace scheduler
 } // namespace ndn
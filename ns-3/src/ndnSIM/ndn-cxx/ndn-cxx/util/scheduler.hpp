@@ -28,7 +28,7 @@
 
 #include "ns3/simulator.h"
 
-#include <set>
+#include <vector>
 
 namespace ndn {
 
@@ -122,6 +122,13 @@ std::ostream& operator<<(std::ostream& os, const EventId& eventId);
 using ScopedEventId = detail::ScopedCancelHandle<EventId>;
 
 /** \brief Generic time-based scheduler
+ *
+ *  Pending events are kept in a binary min-heap ordered by expiration time, with ties broken by
+ *  scheduling order. Every EventInfo knows its position in the heap, so cancellation removes it in
+ *  O(log n) without searching. A single ns-3 timer is armed for the earliest event. As before, the
+ *  timer is re-armed after every cancellation, even one that leaves the earliest event unchanged:
+ *  the position of the new ns-3 event among other ns-3 events at the same time decides whether NFD
+ *  timers run before or after them, and simulations depend on that order.
  */
 class Scheduler : noncopyable {
   public:
@@ -138,6 +145,22 @@ class Scheduler : noncopyable {
      */
     void cancelAllEvents();
 
+    /** \return number of events scheduled so far
+     */
+    uint64_t
+    getNScheduledEvents() const
+    {
+        return m_nextSequence;
+    }
+
+    /** \return number of pending events canceled so far, not counting cancelAllEvents()
+     */
+    uint64_t
+    getNCanceledEvents() const
+    {
+        return m_nCanceledEvents;
+    }
+
   private:
     void cancelImpl(const shared_ptr<EventInfo>& info);
 
@@ -149,17 +172,25 @@ class Scheduler : noncopyable {
      */
     void executeEvent();
 
-  private:
-    class EventQueueCompare {
-      public:
-        bool operator()(const shared_ptr<EventInfo>& a, const shared_ptr<EventInfo>& b) const noexcept;
-    };
+    static bool isBefore(const EventInfo& a, const EventInfo& b) noexcept;
+
+    void siftUp(size_t index);
+
+    void siftDown(size_t index);
 
-    using EventQueue = std::multiset<shared_ptr<EventInfo>, EventQueueCompare>;
+    /** \brief Remove the event at \p index from the heap
+     */
+    void eraseAt(size_t index);
+
+  private:
+    using EventQueue = std::vector<shared_ptr<EventInfo>>;
     EventQueue m_queue;
+    uint64_t m_nextSequence = 0;
+    uint64_t m_nCanceledEvents = 0;
 
     bool m_isEventExecuting = false;
     ndn::optional<ns3::EventId> m_timerEvent;
+    time::steady_clock::TimePoint m_timerExpireTime;
 
     friend EventId;
     friend EventInfo;
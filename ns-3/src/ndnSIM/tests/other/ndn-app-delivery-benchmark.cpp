@@ -0,0 +1,160 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-app-delivery-benchmark.cpp
+//
+// Simulator events per satisfied Interest with and without L3Protocol::DirectAppDelivery.
+// Consumers on --leaves nodes request Data from one producer through a router; every leaf runs
+// --consumers ConsumerCbr applications with distinct prefixes. The same scenario is run twice,
+// once with a ScheduleNow event per packet handed to an application, once with AppDeliveryQueue.
+//
+//     ./waf --run "ndn-app-delivery-benchmark --leaves=10 --consumers=10 --frequency=1000 --duration=10"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class AppDeliveryBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("leaves", "Number of consumer nodes", m_nLeaves);
+        cmd.AddValue("consumers", "Number of consumer applications per node", m_nConsumers);
+        cmd.AddValue("frequency", "Interest sending frequency of every consumer (Interests per second)",
+                     m_frequency);
+        cmd.AddValue("duration", "Simulated time of every run (seconds)", m_duration);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        Result scheduled = runScenario(false);
+        Result direct = runScenario(true);
+
+        print("ScheduleNow per packet", scheduled);
+        print("DirectAppDelivery", direct);
+        if (scheduled.nSatisfied != direct.nSatisfied) {
+            std::cerr << "satisfied Interests differ: " << scheduled.nSatisfied << " != " << direct.nSatisfied
+                      << "\n";
+        }
+        return 0;
+    }
+
+  private:
+    struct Result {
+        uint64_t nEvents = 0;
+        uint64_t nSatisfied = 0;
+        double seconds = 0;
+    };
+
+    Result
+    runScenario(bool isDirect)
+    {
+        Config::SetDefault("ns3::ndn::L3Protocol::DirectAppDelivery", BooleanValue(isDirect));
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("100000p"));
+
+        NodeContainer leaves;
+        leaves.Create(m_nLeaves);
+        NodeContainer core;
+        core.Create(2); // router, producer
+
+        PointToPointHelper p2p;
+        for (uint32_t i = 0; i < leaves.GetN(); ++i) {
+            p2p.Install(leaves.Get(i), core.Get(0));
+        }
+        p2p.Install(core.Get(0), core.Get(1));
+
+        StackHelper ndnHelper;
+        ndnHelper.setCsSize(1);
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/best-route");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        for (uint32_t i = 0; i < leaves.GetN(); ++i) {
+            for (uint32_t j = 0; j < m_nConsumers; ++j) {
+                AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+                consumerHelper.SetPrefix("/prefix/" + std::to_string(i) + "/" + std::to_string(j));
+                consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+                consumerHelper.Install(leaves.Get(i));
+            }
+        }
+
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+        producerHelper.Install(core.Get(1));
+
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", core.Get(1));
+        GlobalRoutingHelper::CalculateRoutes();
+
+        Result result;
+        Simulator::Stop(Seconds(m_duration));
+        result.seconds = benchmark::timedRun([] { Simulator::Run(); });
+        result.nEvents = Simulator::GetEventCount();
+        for (uint32_t i = 0; i < leaves.GetN(); ++i) {
+            const auto& counters = leaves.Get(i)->GetObject<L3Protocol>()->getForwarder()->getCounters();
+            result.nSatisfied += counters.nSatisfiedInterests;
+        }
+
+        Simulator::Destroy();
+        return result;
+    }
+
+    static void
+    print(const std::string& name, const Result& result)
+    {
+        benchmark::printResult(std::cout, name, result.nEvents, result.seconds);
+        std::cout << "satisfied Interests: " << result.nSatisfied;
+        if (result.nSatisfied > 0) {
+            std::cout << ", events per satisfied Interest: "
+                      << static_cast<double>(result.nEvents) / result.nSatisfied;
+        }
+        std::cout << "\n";
+    }
+
+  private:
+    uint32_t m_nLeaves = 10;
+    uint32_t m_nConsumers = 10;
+    double m_frequency = 1000;
+    double m_duration = 10;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::AppDeliveryBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
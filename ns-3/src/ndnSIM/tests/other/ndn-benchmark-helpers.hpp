@@ -0,0 +1,103 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_TESTS_OTHER_NDN_BENCHMARK_HELPERS_HPP
+#define NDNSIM_TESTS_OTHER_NDN_BENCHMARK_HELPERS_HPP
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <new>
+#include <string>
+
+namespace ns3 {
+namespace ndn {
+namespace benchmark {
+
+/**
+ * \brief Run \p f once and return the elapsed wall-clock time in seconds
+ */
+inline double
+timedRun(const std::function<void()>& f)
+{
+    auto t1 = std::chrono::steady_clock::now();
+    f();
+    auto t2 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(t2 - t1).count();
+}
+
+/**
+ * \brief Print one benchmark result line: name, number of operations, time, and rate
+ */
+inline void
+printResult(std::ostream& os, const std::string& name, uint64_t nOps, double seconds)
+{
+    os << name << "\t" << nOps << " ops\t" << seconds << " s\t" << (seconds > 0 ? nOps / seconds : 0)
+       << " ops/s\n";
+}
+
+inline void
+warnIfDebug()
+{
+#ifdef NS3_BUILD_PROFILE_DEBUG
+    std::cerr << "Benchmark compiled in debug mode is unreliable, please compile in optimized mode.\n";
+#endif
+}
+
+#ifdef NDN_BENCHMARK_COUNT_ALLOCATIONS
+/**
+ * \brief Number of calls to the global operator new so far
+ *
+ * Only available when NDN_BENCHMARK_COUNT_ALLOCATIONS is defined before including this file,
+ * which replaces the global operator new of the benchmark program.
+ */
+static uint64_t g_nAllocations = 0;
+#endif // NDN_BENCHMARK_COUNT_ALLOCATIONS
+
+} // namespace benchmark
+} // namespace ndn
+} // namespace ns3
+
+#ifdef NDN_BENCHMARK_COUNT_ALLOCATIONS
+void*
+operator new(size_t size)
+{
+    ++ns3::ndn::benchmark::g_nAllocations;
+    void* p = std::malloc(size == 0 ? 1 : size);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void* p, size_t) noexcept
+{
+    std::free(p);
+}
+#endif // NDN_BENCHMARK_COUNT_ALLOCATIONS
+
+#endif // NDNSIM_TESTS_OTHER_NDN_BENCHMARK_HELPERS_HPP
@@ -0,0 +1,149 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-block-header-benchmark.cpp
+//
+// Compares the cost of turning a received ns-3 packet into an ndn::Block:
+//  - legacy:      Packet::Copy() + RemoveHeader() through a boost::iostreams byte loop
+//  - deserialize: Packet::Copy() + RemoveHeader() with the direct TLV parser
+//  - fromPacket:  BlockHeader::fromPacket(), a single bulk copy out of the const packet
+//
+//     ./waf --run "ndn-block-header-benchmark --payload=1024 --count=1000000"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/ndnSIM-module.h"
+#include "ns3/ndnSIM/model/ndn-block-header.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+#include <ndn-cxx/lp/packet.hpp>
+
+#include <boost/iostreams/concepts.hpp>
+#include <boost/iostreams/stream.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+namespace io = boost::iostreams;
+
+/**
+ * \brief BlockHeader that deserializes through boost::iostreams, one ReadU8() at a time
+ */
+class LegacyBlockHeader : public BlockHeader {
+  public:
+    class Ns3BufferIteratorSource : public io::source {
+      public:
+        Ns3BufferIteratorSource(ns3::Buffer::Iterator& is)
+          : m_is(is)
+        {
+        }
+
+        std::streamsize
+        read(char* buf, std::streamsize nMaxRead)
+        {
+            std::streamsize i = 0;
+            for (; i < nMaxRead && !m_is.IsEnd(); ++i) {
+                buf[i] = m_is.ReadU8();
+            }
+            return i == 0 ? -1 : i;
+        }
+
+      private:
+        ns3::Buffer::Iterator& m_is;
+    };
+
+    virtual uint32_t
+    Deserialize(ns3::Buffer::Iterator start) override
+    {
+        io::stream<Ns3BufferIteratorSource> is(start);
+        getBlock() = ::ndn::Block::fromStream(is);
+        return getBlock().size();
+    }
+};
+
+class BlockHeaderBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        uint32_t payloadSize = 1024;
+        uint32_t count = 1000000;
+
+        CommandLine cmd;
+        cmd.AddValue("payload", "Data payload size in bytes", payloadSize);
+        cmd.AddValue("count", "Number of packets to decode per mode", count);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        auto data = make_shared<Data>("/benchmark/block-header/data");
+        data->setContent(make_shared<::ndn::Buffer>(payloadSize));
+        StackHelper::getKeyChain().sign(*data);
+        lp::Packet lpPacket(data->wireEncode());
+
+        Ptr<Packet> packet = Create<Packet>();
+        packet->AddHeader(BlockHeader(lpPacket.wireEncode()));
+        Ptr<const Packet> received = packet;
+
+        std::cout << "packet size: " << received->GetSize() << " bytes\n";
+
+        size_t checksum = 0;
+
+        double legacy = benchmark::timedRun([&] {
+            for (uint32_t i = 0; i < count; ++i) {
+                Ptr<Packet> copy = received->Copy();
+                LegacyBlockHeader header;
+                copy->RemoveHeader(header);
+                checksum += header.getBlock().size();
+            }
+        });
+        benchmark::printResult(std::cout, "legacy", count, legacy);
+
+        double deserialize = benchmark::timedRun([&] {
+            for (uint32_t i = 0; i < count; ++i) {
+                Ptr<Packet> copy = received->Copy();
+                BlockHeader header;
+                copy->RemoveHeader(header);
+                checksum += header.getBlock().size();
+            }
+        });
+        benchmark::printResult(std::cout, "deserialize", count, deserialize);
+
+        double fromPacket = benchmark::timedRun([&] {
+            for (uint32_t i = 0; i < count; ++i) {
+                checksum += BlockHeader::fromPacket(*received).size();
+            }
+        });
+        benchmark::printResult(std::cout, "fromPacket", count, fromPacket);
+
+        std::cout << "speedup (legacy / fromPacket): " << legacy / fromPacket << "\n";
+        return checksum == 3 * static_cast<size_t>(count) * received->GetSize() ? 0 : 1;
+    }
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::BlockHeaderBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
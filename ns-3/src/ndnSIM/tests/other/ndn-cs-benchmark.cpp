@@ -0,0 +1,132 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-benchmark.cpp
+//
+// Measures Content Store lookups of exact-name Interests (CanBePrefix=false) on a CS holding
+// --entries Data packets, comparing the hash index used by nfd::Cs against a binary search
+// on the ordered table followed by a canSatisfy scan.
+//
+//     ./waf --run "ndn-cs-benchmark --entries=1000000 --lookups=1000000"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+#include <random>
+
+namespace ns3 {
+namespace ndn {
+
+class CsBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("entries", "Number of Data packets in the CS", m_nEntries);
+        cmd.AddValue("lookups", "Number of lookups", m_nLookups);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        nfd::Cs cs(m_nEntries);
+        nfd::cs::Table table;
+        std::vector<shared_ptr<Data>> dataset;
+        dataset.reserve(m_nEntries);
+
+        double insertTime = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nEntries; ++i) {
+                auto data = makeData(Name("/prefix/video/chunk").appendSequenceNumber(i));
+                cs.insert(*data);
+                dataset.push_back(data);
+            }
+        });
+        benchmark::printResult(std::cout, "insert", m_nEntries, insertTime);
+
+        for (const auto& data : dataset) {
+            table.emplace(data, false);
+        }
+
+        // half of the lookups hit, half miss
+        std::mt19937 rng(1);
+        std::uniform_int_distribution<uint64_t> dist(0, m_nEntries * 2 - 1);
+        std::vector<shared_ptr<Interest>> interests;
+        interests.reserve(m_nLookups);
+        for (uint64_t i = 0; i < m_nLookups; ++i) {
+            auto interest = make_shared<Interest>(Name("/prefix/video/chunk").appendSequenceNumber(dist(rng)));
+            interest->setCanBePrefix(false);
+            interest->wireEncode();
+            interests.push_back(interest);
+        }
+
+        size_t nOrderedHits = 0;
+        double ordered = benchmark::timedRun([&] {
+            for (const auto& interest : interests) {
+                const Name& name = interest->getName();
+                auto first = table.lower_bound(name);
+                auto last = table.lower_bound(name.getSuccessor());
+                auto match = std::find_if(first, last, [&](const auto& entry) { return entry.canSatisfy(*interest); });
+                nOrderedHits += match != last;
+            }
+        });
+        benchmark::printResult(std::cout, "lookup, ordered", m_nLookups, ordered);
+
+        size_t nHashHits = 0;
+        double hashed = benchmark::timedRun([&] {
+            for (const auto& interest : interests) {
+                cs.find(*interest, [&](const Interest&, const Data&) { ++nHashHits; }, [](const Interest&) {});
+            }
+        });
+        benchmark::printResult(std::cout, "lookup, hash index", m_nLookups, hashed);
+
+        std::cout << "hits: " << nHashHits << "\n";
+        std::cout << "speedup (ordered / hash index): " << ordered / hashed << "\n";
+        return nOrderedHits == nHashHits ? 0 : 1;
+    }
+
+  private:
+    static shared_ptr<Data>
+    makeData(const Name& name)
+    {
+        auto data = make_shared<Data>(name);
+        data->setFreshnessPeriod(::ndn::time::seconds(3600));
+        data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                            ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+        data->wireEncode();
+        return data;
+    }
+
+  private:
+    uint64_t m_nEntries = 100000;
+    uint64_t m_nLookups = 1000000;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::CsBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
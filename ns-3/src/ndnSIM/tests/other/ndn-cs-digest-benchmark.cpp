@@ -0,0 +1,111 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-digest-benchmark.cpp
+//
+// Content Store insert throughput under duplicate names: --names Data packets are inserted
+// --refreshes times each, every time decoded from a fresh buffer as if received from a face.
+// Compares the CS as is, which only hashes a packet whose name collides with a different
+// packet, against computing the implicit digest of every refreshing packet (the previous
+// behavior of the CS entry comparator).
+//
+//     ./waf --run "ndn-cs-digest-benchmark --names=10000 --refreshes=20 --payload=4096"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsDigestBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("names", "Number of distinct Data names", m_nNames);
+        cmd.AddValue("refreshes", "Number of times each Data is inserted", m_nRefreshes);
+        cmd.AddValue("payload", "Content size; a non-zero pattern so that it is stored as is", m_payloadSize);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        std::vector<Block> wires;
+        wires.reserve(m_nNames);
+        auto content = make_shared<::ndn::Buffer>(m_payloadSize);
+        std::fill(content->begin(), content->end(), 0x5a);
+        for (uint64_t i = 0; i < m_nNames; ++i) {
+            Data data(Name("/prefix/video/chunk").appendSequenceNumber(i));
+            data.setContent(content);
+            data.setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                               ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+            wires.push_back(data.wireEncode());
+        }
+        uint64_t nInserts = m_nNames * m_nRefreshes;
+
+        double digestEach = runInserts("insert, digest every packet", wires, nInserts, [](const Data& data) {
+            data.getFullName();
+        });
+        double compareBytes = runInserts("insert, digest on collision", wires, nInserts, [](const Data&) {});
+
+        std::cout << "speedup (digest every packet / on collision): " << digestEach / compareBytes << "\n";
+        return 0;
+    }
+
+  private:
+    template<typename F>
+    double
+    runInserts(const std::string& label, const std::vector<Block>& wires, uint64_t nInserts, const F& beforeInsert)
+    {
+        nfd::Cs cs(m_nNames);
+        double seconds = benchmark::timedRun([&] {
+            for (uint64_t r = 0; r < m_nRefreshes; ++r) {
+                for (const auto& wire : wires) {
+                    auto data = make_shared<Data>(Block(wire.wire(), wire.size()));
+                    beforeInsert(*data);
+                    cs.insert(*data);
+                }
+            }
+        });
+        benchmark::printResult(std::cout, label, nInserts, seconds);
+        if (cs.size() != m_nNames) {
+            std::cerr << "unexpected CS size " << cs.size() << "\n";
+        }
+        return seconds;
+    }
+
+  private:
+    uint64_t m_nNames = 10000;
+    uint64_t m_nRefreshes = 20;
+    uint32_t m_payloadSize = 4096;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::CsDigestBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
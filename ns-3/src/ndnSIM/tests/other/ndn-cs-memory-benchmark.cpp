@@ -0,0 +1,131 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-cs-memory-benchmark.cpp
+//
+// Measures the memory (resident set size, as reported by MemUsage::Get) needed to keep --entries
+// Data packets with a virtual payload of --payload bytes, as received from the network:
+// once stored in nfd::Cs, which keeps only the headers of such packets, and once held as
+// decoded Data packets, which is how the CS stored them before.  Every CS entry is served once
+// before it is measured, so the figure includes whatever a cache hit leaves behind in the entry.
+//
+//     ./waf --run "ndn-cs-memory-benchmark --entries=100000 --payload=1024"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+#include <ndn-cxx/encoding/zero-buffer.hpp>
+
+#include <fstream>
+#include <unistd.h>
+
+#include "ns3/ndnSIM/utils/mem-usage.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsMemoryBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("entries", "Number of Data packets", m_nEntries);
+        cmd.AddValue("payload", "Virtual payload size of each Data packet (bytes)", m_payloadSize);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        int64_t before = MemUsage::Get();
+        nfd::Cs cs(m_nEntries);
+        for (uint64_t i = 0; i < m_nEntries; ++i) {
+            cs.insert(*receiveData(i));
+        }
+        uint64_t nHits = 0;
+        for (uint64_t i = 0; i < m_nEntries; ++i) {
+            cs.find(Interest(makeName(i)), [&nHits](const Interest&, const Data&) { ++nHits; },
+                    [](const Interest&) {});
+        }
+        int64_t compact = MemUsage::Get() - before;
+
+        before = MemUsage::Get();
+        std::vector<shared_ptr<const Data>> packets;
+        packets.reserve(m_nEntries);
+        for (uint64_t i = 0; i < m_nEntries; ++i) {
+            packets.push_back(receiveData(i));
+        }
+        int64_t full = MemUsage::Get() - before;
+
+        std::cout << "entries: " << cs.size() << " (" << nHits << " served), payload: " << m_payloadSize
+                  << " bytes\n";
+        print("cs, virtual payload", compact);
+        print("decoded Data", full);
+        if (compact > 0) {
+            std::cout << "savings: " << full - compact << " bytes (" << static_cast<double>(full) / compact
+                      << "x less memory)\n";
+        }
+        return 0;
+    }
+
+  private:
+    static Name
+    makeName(uint64_t seq)
+    {
+        return Name("/prefix/video/chunk").appendSequenceNumber(seq);
+    }
+
+    /** \brief create a Data packet decoded from its own wire buffer, like a packet received by a face
+     */
+    shared_ptr<const Data>
+    receiveData(uint64_t seq)
+    {
+        auto data = make_shared<Data>(makeName(seq));
+        data->setFreshnessPeriod(::ndn::time::seconds(3600));
+        data->setContent(::ndn::getZeroBuffer(m_payloadSize));
+        data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                            ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+        const Block& wire = data->wireEncode();
+        return make_shared<Data>(Block(make_shared<::ndn::Buffer>(wire.begin(), wire.end())));
+    }
+
+    void
+    print(const std::string& name, int64_t bytes)
+    {
+        std::cout << name << "\t" << bytes << " bytes\t" << static_cast<double>(bytes) / m_nEntries
+                  << " bytes/entry\n";
+    }
+
+  private:
+    uint64_t m_nEntries = 100000;
+    uint32_t m_payloadSize = 1024;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::CsMemoryBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-dead-nonce-list-benchmark.cpp
+//
+// Dead Nonce List lookup and insert rates at a steady state of about --entries entries.
+// The list is first filled in simulated time at --entries per --lifetime, so that the mark-based
+// capacity adaptation grows the list to its steady-state size, then has() and add() are timed.
+//
+//     ./waf --run "ndn-dead-nonce-list-benchmark --entries=1000000 --ops=10000000"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-time.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class DeadNonceListBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("entries", "Expected number of entries at steady state", m_nEntries);
+        cmd.AddValue("ops", "Number of operations per measurement", m_nOps);
+        cmd.AddValue("names", "Number of distinct Interest names", m_nNames);
+        cmd.AddValue("warmup", "Warm-up duration, in number of lifetimes", m_nWarmupLifetimes);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        // 没有安装协议栈时, NFD 的定时器也要使用模拟时间
+        ::ndn::time::setCustomClocks(make_shared<time::CustomSteadyClock>(), make_shared<time::CustomSystemClock>());
+
+        for (uint32_t i = 0; i < m_nNames; ++i) {
+            m_names.push_back(Name("/prefix/video/chunk").appendSequenceNumber(i));
+        }
+
+        const time::nanoseconds lifetime = time::seconds(1);
+        nfd::DeadNonceList dnl(lifetime);
+
+        // 每 1ms 插入 entries/1000 个条目, 即每个 lifetime 插入 entries 个
+        const uint64_t nPerTick = std::max<uint64_t>(m_nEntries / 1000, 1);
+        for (uint64_t t = 0; t < m_nWarmupLifetimes * 1000; ++t) {
+            nfd::getScheduler().schedule(time::milliseconds(t), [this, &dnl, nPerTick] {
+                for (uint64_t i = 0; i < nPerTick; ++i) {
+                    add(dnl);
+                }
+            });
+        }
+        double seconds = benchmark::timedRun([&] {
+            Simulator::Stop(Seconds(m_nWarmupLifetimes));
+            Simulator::Run();
+        });
+        benchmark::printResult(std::cout, "warm-up add", m_nSeq, seconds);
+        std::cout << "\t" << dnl.size() << " entries\n";
+
+        // 最近插入的条目一定仍在 Dead Nonce List 中
+        uint64_t nHits = std::min<uint64_t>(m_nOps, dnl.size());
+        uint64_t nFound = 0;
+        seconds = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nOps; ++i) {
+                uint64_t seq = m_nSeq - 1 - (i % nHits);
+                nFound += dnl.has(m_names[seq % m_nNames], static_cast<uint32_t>(seq));
+            }
+        });
+        benchmark::printResult(std::cout, "has, hit", m_nOps, seconds);
+        checkFound(nFound, m_nOps);
+
+        nFound = 0;
+        seconds = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nOps; ++i) {
+                uint64_t seq = m_nSeq + i;
+                nFound += dnl.has(m_names[seq % m_nNames], static_cast<uint32_t>(seq));
+            }
+        });
+        benchmark::printResult(std::cout, "has, miss", m_nOps, seconds);
+        checkFound(nFound, 0);
+
+        seconds = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nOps; ++i) {
+                add(dnl);
+            }
+        });
+        benchmark::printResult(std::cout, "add", m_nOps, seconds);
+        std::cout << "\t" << dnl.size() << " entries\n";
+
+        Simulator::Destroy();
+        return 0;
+    }
+
+  private:
+    void
+    add(nfd::DeadNonceList& dnl)
+    {
+        dnl.add(m_names[m_nSeq % m_nNames], static_cast<uint32_t>(m_nSeq));
+        ++m_nSeq;
+    }
+
+    static void
+    checkFound(uint64_t nFound, uint64_t nExpected)
+    {
+        // 允许极少数哈希误判
+        if (nFound < nExpected || nFound > nExpected + nExpected / 1000 + 10) {
+            std::cerr << "unexpected number of hits: " << nFound << ", expected " << nExpected << "\n";
+        }
+    }
+
+  private:
+    uint64_t m_nEntries = 1000000;
+    uint64_t m_nOps = 10000000;
+    uint32_t m_nNames = 1000;
+    uint32_t m_nWarmupLifetimes = 60;
+
+    std::vector<Name> m_names;
+    uint64_t m_nSeq = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::DeadNonceListBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
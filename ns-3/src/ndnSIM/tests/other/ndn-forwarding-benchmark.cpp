@@ -0,0 +1,251 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-forwarding-benchmark.cpp
+//
+// Measures per-packet cost of the forwarding pipelines.
+//
+// The first part compares the name classification used by Forwarder and Cs to filter management
+// (/localhost) packets: the former "toUri() + substring search" approach against
+// nfd::scope_prefix::isLocalhost / isLocalhostNfd.
+//
+// The second part feeds a standalone Forwarder with bursts of --batch Interests arriving at the same
+// instant on different faces, whose names fall under --prefixes parent prefixes. Every burst is
+// processed once with startProcessInterest per Interest and once with startProcessInterests.
+//
+// The third part runs a consumer-router-producer line at a high Interest rate and reports the
+// wall-clock time spent per forwarded packet.
+//
+//     ./waf --run "ndn-forwarding-benchmark --names=1000000 --interests=200000 --batch=32 --frequency=100000 --duration=10"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/scope-prefix.hpp"
+
+#include "ns3/ndnSIM/utils/ndn-time.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ForwardingBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("names", "Number of names to classify", m_nNames);
+        cmd.AddValue("interests", "Number of Interests fed to the standalone Forwarder", m_nInterests);
+        cmd.AddValue("batch", "Number of Interests arriving at the same instant", m_batchSize);
+        cmd.AddValue("prefixes", "Number of distinct parent prefixes within a burst", m_nPrefixes);
+        cmd.AddValue("frequency", "Interest sending frequency of the consumer (Interests per second)", m_frequency);
+        cmd.AddValue("duration", "Simulated time of the forwarding run (seconds)", m_duration);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        // 没有安装协议栈时, NFD 的定时器也要使用模拟时间
+        ::ndn::time::setCustomClocks(make_shared<time::CustomSteadyClock>(), make_shared<time::CustomSystemClock>());
+
+        runClassification();
+        runBatching(false);
+        runBatching(true);
+        runForwarding();
+        return 0;
+    }
+
+  private:
+    void
+    runClassification()
+    {
+        // mix of content names as seen on the data plane and management names as seen on every node
+        std::vector<Name> names;
+        names.reserve(m_nNames);
+        for (uint64_t i = 0; i < m_nNames; ++i) {
+            if (i % 10 == 0) {
+                names.push_back(Name("/localhost/nfd/rib/register").appendNumber(i));
+            }
+            else {
+                names.push_back(Name("/prefix/video/chunk").appendSequenceNumber(i));
+            }
+        }
+
+        size_t nLegacy = 0;
+        double legacy = benchmark::timedRun([&] {
+            for (const Name& name : names) {
+                nLegacy += name.toUri().find("/localhost/") == std::string::npos;
+                nLegacy += name.toUri().find("/localhost/nfd/") == std::string::npos;
+            }
+        });
+        benchmark::printResult(std::cout, "classify, toUri", names.size(), legacy);
+
+        size_t nComponent = 0;
+        double component = benchmark::timedRun([&] {
+            for (const Name& name : names) {
+                nComponent += !::nfd::scope_prefix::isLocalhost(name);
+                nComponent += !::nfd::scope_prefix::isLocalhostNfd(name);
+            }
+        });
+        benchmark::printResult(std::cout, "classify, component", names.size(), component);
+
+        std::cout << "speedup (toUri / component): " << legacy / component << "\n";
+        if (nLegacy != nComponent) {
+            std::cerr << "classification mismatch: " << nLegacy << " != " << nComponent << "\n";
+        }
+    }
+
+    void
+    runBatching(bool isBatched)
+    {
+        const auto interestLifetime = time::milliseconds(10);
+        const auto burstInterval = time::microseconds(10);
+
+        std::vector<shared_ptr<Interest>> interests;
+        interests.reserve(m_nInterests);
+        for (uint64_t i = 0; i < m_nInterests; ++i) {
+            Name name("/prefix/video");
+            name.appendNumber(i % m_nPrefixes).appendSequenceNumber(i);
+            auto interest = make_shared<Interest>(name);
+            interest->setNonce(static_cast<uint32_t>(i));
+            interest->setInterestLifetime(interestLifetime);
+            interest->wireEncode();
+            interests.push_back(interest);
+        }
+
+        nfd::FaceTable faceTable;
+        nfd::Forwarder forwarder(faceTable);
+        std::vector<shared_ptr<nfd::Face>> inFaces;
+        for (uint32_t i = 0; i < m_batchSize; ++i) {
+            inFaces.push_back(nfd::face::makeNullFace());
+            faceTable.add(inFaces.back());
+        }
+        auto outFace = nfd::face::makeNullFace();
+        faceTable.add(outFace);
+        forwarder.getFib().addOrUpdateNextHop(*forwarder.getFib().insert("/prefix").first, *outFace, 0);
+
+        // 每个 burst 的兴趣包在同一时刻从不同的 face 到达
+        std::vector<nfd::Forwarder::IncomingInterest> batch;
+        uint64_t nBursts = (m_nInterests + m_batchSize - 1) / m_batchSize;
+        for (uint64_t b = 0; b < nBursts; ++b) {
+            nfd::getScheduler().schedule(burstInterval * b, [&, b] {
+                uint64_t end = std::min<uint64_t>((b + 1) * m_batchSize, m_nInterests);
+                if (isBatched) {
+                    batch.clear();
+                    for (uint64_t i = b * m_batchSize; i < end; ++i) {
+                        batch.push_back({nfd::FaceEndpoint(*inFaces[i % m_batchSize], 0), *interests[i]});
+                    }
+                    forwarder.startProcessInterests(batch);
+                }
+                else {
+                    for (uint64_t i = b * m_batchSize; i < end; ++i) {
+                        forwarder.startProcessInterest(nfd::FaceEndpoint(*inFaces[i % m_batchSize], 0),
+                                                       *interests[i]);
+                    }
+                }
+            });
+        }
+
+        // 包括所有 PIT 条目过期所需的时间
+        Simulator::Stop(NanoSeconds((burstInterval * nBursts + interestLifetime * 2).count()));
+        double elapsed = benchmark::timedRun([] { Simulator::Run(); });
+
+        const auto& counters = forwarder.getCounters();
+        benchmark::printResult(std::cout, isBatched ? "Interests, batched" : "Interests, single", m_nInterests,
+                               elapsed);
+        std::cout << "\t" << counters.nOutInterests << " forwarded\t" << counters.nUnsatisfiedInterests
+                  << " expired\n";
+    }
+
+    void
+    runForwarding()
+    {
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("100000p"));
+
+        NodeContainer nodes;
+        nodes.Create(3);
+
+        PointToPointHelper p2p;
+        p2p.Install(nodes.Get(0), nodes.Get(1));
+        p2p.Install(nodes.Get(1), nodes.Get(2));
+
+        StackHelper ndnHelper;
+        ndnHelper.setCsSize(1);
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/best-route");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+        consumerHelper.SetPrefix("/prefix");
+        consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+        consumerHelper.Install(nodes.Get(0));
+
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+        producerHelper.Install(nodes.Get(2));
+
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", nodes.Get(2));
+        GlobalRoutingHelper::CalculateRoutes();
+
+        Simulator::Stop(Seconds(m_duration));
+        double elapsed = benchmark::timedRun([] { Simulator::Run(); });
+
+        uint64_t nPackets = 0;
+        for (uint32_t id = 0; id < nodes.GetN(); ++id) {
+            const auto& counters = nodes.Get(id)->GetObject<L3Protocol>()->getForwarder()->getCounters();
+            nPackets += counters.nInInterests + counters.nInData;
+        }
+        benchmark::printResult(std::cout, "forwarding", nPackets, elapsed);
+        if (nPackets > 0) {
+            std::cout << "per packet: " << elapsed / nPackets * 1e9 << " ns\n";
+        }
+
+        Simulator::Destroy();
+    }
+
+  private:
+    uint64_t m_nNames = 1000000;
+    uint64_t m_nInterests = 200000;
+    uint32_t m_batchSize = 32;
+    uint32_t m_nPrefixes = 4;
+    double m_frequency = 100000;
+    double m_duration = 10;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::ForwardingBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
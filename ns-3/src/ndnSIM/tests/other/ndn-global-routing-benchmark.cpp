@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-global-routing-benchmark.cpp
+//
+// Measures route setup time of GlobalRoutingHelper::CalculateRoutes on a grid topology in which
+// every node originates its own prefix, installing routes either through the FIB manager
+// (signed command Interests) or directly into the FIB, with shortest paths computed on one or
+// on several threads.
+//
+//     ./waf --run "ndn-global-routing-benchmark --rows=20 --cols=20 --threads=8"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class GlobalRoutingBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("rows", "Number of rows in the grid", m_rows);
+        cmd.AddValue("cols", "Number of columns in the grid", m_cols);
+        cmd.AddValue("rib", "Also record routes in the RIB in direct mode", m_updateRib);
+        cmd.AddValue("threads", "Number of route calculation threads (0: one per hardware thread)", m_nThreads);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        std::cout << "topology: " << m_rows << "x" << m_cols << " grid, " << m_rows * m_cols << " prefixes\n";
+
+        size_t commandRoutes = 0;
+        double command = runOnce(false, 1, commandRoutes);
+        benchmark::printResult(std::cout, "command", commandRoutes, command);
+
+        size_t directRoutes = 0;
+        double direct = runOnce(true, 1, directRoutes);
+        benchmark::printResult(std::cout, "direct", directRoutes, direct);
+
+        size_t parallelRoutes = 0;
+        double parallel = runOnce(true, m_nThreads, parallelRoutes);
+        benchmark::printResult(std::cout, "direct, parallel", parallelRoutes, parallel);
+
+        std::cout << "speedup (command / direct): " << command / direct << "\n";
+        std::cout << "speedup (command / direct, parallel): " << command / parallel << "\n";
+        return commandRoutes == directRoutes && directRoutes == parallelRoutes ? 0 : 1;
+    }
+
+  private:
+    double
+    runOnce(bool isDirect, uint32_t nThreads, size_t& nFibEntries)
+    {
+        NodeContainer nodes;
+        nodes.Create(m_rows * m_cols);
+
+        PointToPointHelper p2p;
+        for (uint32_t row = 0; row < m_rows; ++row) {
+            for (uint32_t col = 0; col < m_cols; ++col) {
+                uint32_t id = row * m_cols + col;
+                if (col + 1 < m_cols) {
+                    p2p.Install(nodes.Get(id), nodes.Get(id + 1));
+                }
+                if (row + 1 < m_rows) {
+                    p2p.Install(nodes.Get(id), nodes.Get(id + m_cols));
+                }
+            }
+        }
+
+        StackHelper ndnHelper;
+        ndnHelper.InstallAll();
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+        for (uint32_t id = 0; id < nodes.GetN(); ++id) {
+            ndnGlobalRoutingHelper.AddOrigin("/node" + std::to_string(id), nodes.Get(id));
+        }
+
+        GlobalRoutingHelper::SetDirectFibInstallation(isDirect, m_updateRib);
+        GlobalRoutingHelper::SetRouteCalculationThreads(nThreads);
+        double elapsed = benchmark::timedRun([isDirect] {
+            GlobalRoutingHelper::CalculateRoutes();
+            if (!isDirect) {
+                // command Interests are only scheduled here; the FIB manager processes them, without
+                // advancing the simulation time, once the simulator runs
+                Simulator::Stop(NanoSeconds(1));
+                Simulator::Run();
+            }
+        });
+        GlobalRoutingHelper::SetRouteCalculationThreads(0);
+        GlobalRoutingHelper::SetDirectFibInstallation(false);
+
+        nFibEntries = 0;
+        for (uint32_t id = 0; id < nodes.GetN(); ++id) {
+            nFibEntries += nodes.Get(id)->GetObject<L3Protocol>()->getForwarder()->getFib().size();
+        }
+
+        Simulator::Destroy();
+        Names::Clear();
+        GlobalRouter::clear();
+        return elapsed;
+    }
+
+  private:
+    uint32_t m_rows = 10;
+    uint32_t m_cols = 10;
+    bool m_updateRib = false;
+    uint32_t m_nThreads = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::GlobalRoutingBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
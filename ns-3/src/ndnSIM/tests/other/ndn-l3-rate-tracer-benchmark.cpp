@@ -0,0 +1,150 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+// ndn-l3-rate-tracer-benchmark.cpp
+//
+// Per-packet cost of L3RateTracer::InstallAll. The same scenario (--leaves consumer nodes,
+// each connected to one router, which is connected to a producer) is run without tracing and
+// with L3RateTracer installed on all nodes; the difference of the wall-clock times is divided by
+// the number of packets seen by the forwarders, i.e., by the number of trace callbacks.
+//
+//     ./waf --run "ndn-l3-rate-tracer-benchmark --leaves=50 --frequency=1000 --duration=10"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class L3RateTracerBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("leaves", "Number of consumer nodes", m_nLeaves);
+        cmd.AddValue("frequency", "Interest sending frequency of every consumer (Interests per second)",
+                     m_frequency);
+        cmd.AddValue("duration", "Simulated time of every run (seconds)", m_duration);
+        cmd.AddValue("period", "Averaging period of the tracer (seconds)", m_period);
+        cmd.AddValue("file", "Trace file", m_file);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        Result plain = runScenario(false);
+        Result traced = runScenario(true);
+
+        benchmark::printResult(std::cout, "without tracer", plain.nPackets, plain.seconds);
+        benchmark::printResult(std::cout, "L3RateTracer::InstallAll", traced.nPackets, traced.seconds);
+        if (traced.nPackets > 0) {
+            std::cout << "tracing overhead per packet: " << (traced.seconds - plain.seconds) / traced.nPackets * 1e9
+                      << " ns\n";
+        }
+        return 0;
+    }
+
+  private:
+    struct Result {
+        uint64_t nPackets = 0;
+        double seconds = 0;
+    };
+
+    Result
+    runScenario(bool isTraced)
+    {
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("100000p"));
+
+        NodeContainer leaves;
+        leaves.Create(m_nLeaves);
+        NodeContainer core;
+        core.Create(2); // router, producer
+
+        PointToPointHelper p2p;
+        for (uint32_t i = 0; i < leaves.GetN(); ++i) {
+            p2p.Install(leaves.Get(i), core.Get(0));
+        }
+        p2p.Install(core.Get(0), core.Get(1));
+
+        StackHelper ndnHelper;
+        ndnHelper.setCsSize(1);
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/best-route");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        for (uint32_t i = 0; i < leaves.GetN(); ++i) {
+            AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+            consumerHelper.SetPrefix("/prefix/" + std::to_string(i));
+            consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+            consumerHelper.Install(leaves.Get(i));
+        }
+
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+        producerHelper.Install(core.Get(1));
+
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", core.Get(1));
+        GlobalRoutingHelper::CalculateRoutes();
+
+        if (isTraced) {
+            L3RateTracer::InstallAll(m_file, Seconds(m_period));
+        }
+
+        Result result;
+        Simulator::Stop(Seconds(m_duration));
+        result.seconds = benchmark::timedRun([] { Simulator::Run(); });
+
+        for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); ++node) {
+            const auto& counters = (*node)->GetObject<L3Protocol>()->getForwarder()->getCounters();
+            result.nPackets += counters.nInInterests + counters.nOutInterests + counters.nInData + counters.nOutData;
+        }
+
+        L3RateTracer::Destroy();
+        Simulator::Destroy();
+        return result;
+    }
+
+  private:
+    uint32_t m_nLeaves = 50;
+    double m_frequency = 1000;
+    double m_duration = 10;
+    double m_period = 1;
+    std::string m_file = "l3-rate-tracer-benchmark.txt";
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::L3RateTracerBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-measurements-benchmark.cpp
+//
+// Scheduler operations per packet with the ASF strategy, which extends the lifetime of its
+// Measurements entries on every Interest and Data. Consumers on node 0 reach --producers producers
+// through one router; every node uses ASF. Reports the wall-clock time, and the ndn::Scheduler
+// schedule and cancel operations per Interest received by any forwarder.
+//
+//     ./waf --run "ndn-measurements-benchmark --producers=3 --consumers=10 --frequency=1000 --duration=10"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class MeasurementsBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("producers", "Number of producers, i.e. ASF nexthops of the router", m_nProducers);
+        cmd.AddValue("consumers", "Number of consumer applications", m_nConsumers);
+        cmd.AddValue("frequency", "Interest sending frequency of every consumer (Interests per second)",
+                     m_frequency);
+        cmd.AddValue("duration", "Simulated time (seconds)", m_duration);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("100000p"));
+
+        NodeContainer nodes;
+        nodes.Create(2 + m_nProducers);
+
+        PointToPointHelper p2p;
+        p2p.Install(nodes.Get(0), nodes.Get(1));
+        for (uint32_t i = 0; i < m_nProducers; ++i) {
+            p2p.Install(nodes.Get(1), nodes.Get(2 + i));
+        }
+
+        StackHelper ndnHelper;
+        ndnHelper.setCsSize(1);
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/asf");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        for (uint32_t i = 0; i < m_nConsumers; ++i) {
+            AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+            consumerHelper.SetPrefix("/prefix/" + std::to_string(i));
+            consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+            consumerHelper.Install(nodes.Get(0));
+        }
+
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        for (uint32_t i = 0; i < m_nProducers; ++i) {
+            producerHelper.Install(nodes.Get(2 + i));
+            ndnGlobalRoutingHelper.AddOrigins("/prefix", nodes.Get(2 + i));
+        }
+        GlobalRoutingHelper::CalculateAllPossibleRoutes();
+
+        auto& scheduler = nfd::getScheduler();
+        uint64_t nScheduled = scheduler.getNScheduledEvents();
+        uint64_t nCanceled = scheduler.getNCanceledEvents();
+
+        Simulator::Stop(Seconds(m_duration));
+        double seconds = benchmark::timedRun([] { Simulator::Run(); });
+
+        nScheduled = scheduler.getNScheduledEvents() - nScheduled;
+        nCanceled = scheduler.getNCanceledEvents() - nCanceled;
+
+        uint64_t nInterests = 0;
+        uint64_t nData = 0;
+        for (uint32_t i = 0; i < nodes.GetN(); ++i) {
+            const auto& counters = nodes.Get(i)->GetObject<L3Protocol>()->getForwarder()->getCounters();
+            nInterests += counters.nInInterests;
+            nData += counters.nInData;
+        }
+
+        benchmark::printResult(std::cout, "ASF forwarding", nInterests, seconds);
+        std::cout << "\t" << nData << " Data received\n"
+                  << "\t" << static_cast<double>(nScheduled) / nInterests << " schedules/Interest\t"
+                  << static_cast<double>(nCanceled) / nInterests << " cancels/Interest\n";
+
+        Simulator::Destroy();
+        return 0;
+    }
+
+  private:
+    uint32_t m_nProducers = 3;
+    uint32_t m_nConsumers = 10;
+    double m_frequency = 1000;
+    double m_duration = 10;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::MeasurementsBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
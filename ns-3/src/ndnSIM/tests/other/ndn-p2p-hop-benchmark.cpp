@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+// ndn-p2p-hop-benchmark.cpp
+//
+// Packets crossing point-to-point hops per wall-clock second, with and without
+// L3Protocol::SingleCopyPointToPoint. A consumer and a producer are connected through a chain of
+// --hops links; every Interest and Data crosses every link once.
+//
+//     ./waf --run "ndn-p2p-hop-benchmark --hops=10 --consumers=10 --frequency=1000 --payload=1024 --duration=10"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class P2pHopBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("hops", "Number of links between consumers and producer", m_nHops);
+        cmd.AddValue("consumers", "Number of consumer applications", m_nConsumers);
+        cmd.AddValue("frequency", "Interest sending frequency of every consumer (Interests per second)",
+                     m_frequency);
+        cmd.AddValue("payload", "Data payload size", m_payloadSize);
+        cmd.AddValue("duration", "Simulated time of every run (seconds)", m_duration);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        for (bool isSingleCopy : {false, true}) {
+            uint64_t nHops = 0;
+            double seconds = runScenario(isSingleCopy, nHops);
+            benchmark::printResult(std::cout, isSingleCopy ? "SingleCopyPointToPoint" : "decode every hop", nHops,
+                                   seconds);
+        }
+        return 0;
+    }
+
+  private:
+    double
+    runScenario(bool isSingleCopy, uint64_t& nHops)
+    {
+        Config::SetDefault("ns3::ndn::L3Protocol::SingleCopyPointToPoint", BooleanValue(isSingleCopy));
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("100Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("100000p"));
+
+        NodeContainer nodes;
+        nodes.Create(m_nHops + 1);
+
+        PointToPointHelper p2p;
+        for (uint32_t i = 0; i < m_nHops; ++i) {
+            p2p.Install(nodes.Get(i), nodes.Get(i + 1));
+        }
+
+        StackHelper ndnHelper;
+        ndnHelper.setCsSize(1);
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/best-route");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        for (uint32_t i = 0; i < m_nConsumers; ++i) {
+            AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+            consumerHelper.SetPrefix("/prefix/" + std::to_string(i));
+            consumerHelper.SetAttribute("Frequency", DoubleValue(m_frequency));
+            consumerHelper.Install(nodes.Get(0));
+        }
+
+        Ptr<Node> producer = nodes.Get(m_nHops);
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        producerHelper.SetAttribute("PayloadSize", UintegerValue(m_payloadSize));
+        producerHelper.Install(producer);
+
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", producer);
+        GlobalRoutingHelper::CalculateRoutes();
+
+        Simulator::Stop(Seconds(m_duration));
+        double seconds = benchmark::timedRun([] { Simulator::Run(); });
+
+        // packets received from links: Interests on nodes 1..N, Data on nodes 0..N-1
+        nHops = 0;
+        for (uint32_t i = 0; i <= m_nHops; ++i) {
+            const auto& counters = nodes.Get(i)->GetObject<L3Protocol>()->getForwarder()->getCounters();
+            if (i > 0) {
+                nHops += counters.nInInterests;
+            }
+            if (i < m_nHops) {
+                nHops += counters.nInData;
+            }
+        }
+
+        Simulator::Destroy();
+        return seconds;
+    }
+
+  private:
+    uint32_t m_nHops = 10;
+    uint32_t m_nConsumers = 10;
+    double m_frequency = 1000;
+    uint32_t m_payloadSize = 1024;
+    double m_duration = 10;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::P2pHopBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-pit-benchmark.cpp
+//
+// PIT churn: every Interest inserts a PIT entry with one in-record and one out-record, and the
+// oldest entry is erased once --window entries are pending. Reports time and heap allocations
+// per Interest, counted by replacing the global operator new.
+//
+//     ./waf --run "ndn-pit-benchmark --interests=1000000 --window=1000"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/pit.hpp"
+
+#define NDN_BENCHMARK_COUNT_ALLOCATIONS
+#include "ndn-benchmark-helpers.hpp"
+
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+class PitBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("interests", "Number of Interests", m_nInterests);
+        cmd.AddValue("window", "Number of pending PIT entries", m_window);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        auto inFace = nfd::face::makeNullFace();
+        auto outFace = nfd::face::makeNullFace();
+
+        std::vector<shared_ptr<Interest>> interests;
+        interests.reserve(m_nInterests);
+        for (uint64_t i = 0; i < m_nInterests; ++i) {
+            auto interest = make_shared<Interest>(Name("/prefix/video/chunk").appendSequenceNumber(i));
+            interest->setNonce(static_cast<uint32_t>(i));
+            interest->wireEncode();
+            interests.push_back(interest);
+        }
+
+        // PIT entry and records alone, allocated the way they were before pooling
+        {
+            std::deque<std::tuple<shared_ptr<nfd::pit::Entry>, std::list<nfd::pit::InRecord>,
+                                  std::list<nfd::pit::OutRecord>>> pending;
+            runChurn("entry + records, std::allocator", interests, [&](const Interest& interest) {
+                pending.emplace_back(make_shared<nfd::pit::Entry>(interest), std::list<nfd::pit::InRecord>(),
+                                     std::list<nfd::pit::OutRecord>());
+                std::get<1>(pending.back()).emplace_front(*inFace);
+                std::get<1>(pending.back()).front().update(interest);
+                std::get<2>(pending.back()).emplace_front(*outFace);
+                std::get<2>(pending.back()).front().update(interest);
+                if (pending.size() > m_window) {
+                    pending.pop_front();
+                }
+            });
+        }
+
+        {
+            std::deque<shared_ptr<nfd::pit::Entry>> pending;
+            runChurn("entry + records, pool", interests, [&](const Interest& interest) {
+                auto entry = std::allocate_shared<nfd::pit::Entry>(nfd::pit::PoolAllocator<nfd::pit::Entry>(), interest);
+                entry->insertOrUpdateInRecord(*inFace, interest);
+                entry->insertOrUpdateOutRecord(*outFace, interest);
+                pending.push_back(std::move(entry));
+                if (pending.size() > m_window) {
+                    pending.pop_front();
+                }
+            });
+        }
+
+        {
+            nfd::NameTree nameTree;
+            nfd::Pit pit(nameTree);
+            std::deque<shared_ptr<nfd::pit::Entry>> pending;
+            runChurn("Pit insert + erase", interests, [&](const Interest& interest) {
+                auto entry = pit.insert(interest).first;
+                entry->insertOrUpdateInRecord(*inFace, interest);
+                entry->insertOrUpdateOutRecord(*outFace, interest);
+                pending.push_back(std::move(entry));
+                if (pending.size() > m_window) {
+                    pit.erase(pending.front().get());
+                    pending.pop_front();
+                }
+            });
+        }
+
+        return 0;
+    }
+
+  private:
+    template<typename F>
+    void
+    runChurn(const std::string& name, const std::vector<shared_ptr<Interest>>& interests, const F& processInterest)
+    {
+        uint64_t nAllocations = benchmark::g_nAllocations;
+        double seconds = benchmark::timedRun([&] {
+            for (const auto& interest : interests) {
+                processInterest(*interest);
+            }
+        });
+        nAllocations = benchmark::g_nAllocations - nAllocations;
+
+        benchmark::printResult(std::cout, name, m_nInterests, seconds);
+        std::cout << "\t" << static_cast<double>(nAllocations) / m_nInterests << " allocations/Interest\n";
+    }
+
+  private:
+    uint64_t m_nInterests = 1000000;
+    uint64_t m_window = 1000;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::PitBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-producer-benchmark.cpp
+//
+// Measures how fast a Producer can turn Interests into encoded Data packets, without any
+// forwarding: building every Data from scratch and calling wireEncode() (the old
+// Producer::OnInterest) against splicing the Interest name into a DataTemplate.
+//
+//     ./waf --run "ndn-producer-benchmark --interests=1000000 --payload=1024"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/utils/ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/zero-buffer.hpp>
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class ProducerBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("interests", "Number of Interests to answer", m_nInterests);
+        cmd.AddValue("payload", "Virtual payload size of each Data", m_payloadSize);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        std::vector<shared_ptr<Interest>> interests;
+        interests.reserve(m_nInterests);
+        for (uint64_t i = 0; i < m_nInterests; ++i) {
+            auto interest = make_shared<Interest>(Name("/prefix/video/chunk").appendSequenceNumber(i));
+            interest->wireEncode();
+            interests.push_back(interest);
+        }
+
+        size_t nBytes = 0;
+        double rebuild = benchmark::timedRun([&] {
+            for (const auto& interest : interests) {
+                nBytes += makeData(interest->getName())->wireEncode().size();
+            }
+        });
+        benchmark::printResult(std::cout, "produce, encode every Data", m_nInterests, rebuild);
+
+        size_t nTemplateBytes = 0;
+        double spliced = benchmark::timedRun([&] {
+            DataTemplate dataTemplate(*makeData(Name()));
+            for (const auto& interest : interests) {
+                nTemplateBytes += dataTemplate.makeData(interest->getName())->wireEncode().size();
+            }
+        });
+        benchmark::printResult(std::cout, "produce, Data template", m_nInterests, spliced);
+
+        std::cout << "speedup (encode / template): " << rebuild / spliced << "\n";
+        return nBytes == nTemplateBytes ? 0 : 1;
+    }
+
+  private:
+    shared_ptr<Data>
+    makeData(const Name& name) const
+    {
+        auto data = make_shared<Data>(name);
+        data->setFreshnessPeriod(::ndn::time::milliseconds(0));
+        data->setContent(::ndn::getZeroBuffer(m_payloadSize));
+        data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                            ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+        data->wireEncode();
+        return data;
+    }
+
+  private:
+    uint64_t m_nInterests = 1000000;
+    uint32_t m_payloadSize = 1024;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::ProducerBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,136 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-scheduler-benchmark.cpp
+//
+// ndn::Scheduler churn as produced by PIT expiry timers: every operation schedules a timer with a
+// fixed lifetime and cancels the timer scheduled --window operations earlier.
+//
+// The first part performs the schedule/cancel pairs back to back at one simulated instant. The
+// second part issues one pair per simulated microsecond from an ns-3 event and also reports how
+// many ns-3 events were executed per pair.
+//
+//     ./waf --run "ndn-scheduler-benchmark --pairs=1000000 --window=1000"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include "ndn-benchmark-helpers.hpp"
+
+#include <deque>
+
+namespace ns3 {
+namespace ndn {
+
+using ::ndn::scheduler::EventId;
+
+class SchedulerBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("pairs", "Number of schedule/cancel pairs", m_nPairs);
+        cmd.AddValue("window", "Number of pending timers", m_window);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        runBackToBack();
+        runSimulated();
+        return 0;
+    }
+
+  private:
+    void
+    scheduleAndCancel()
+    {
+        m_pending.push_back(m_scheduler->schedule(::ndn::time::seconds(1), [] {}));
+        if (m_pending.size() > m_window) {
+            m_pending.front().cancel();
+            m_pending.pop_front();
+        }
+    }
+
+    void
+    runBackToBack()
+    {
+        ::ndn::DummyIoService io;
+        m_scheduler = make_unique<::ndn::Scheduler>(io);
+
+        double elapsed = benchmark::timedRun([this] {
+            for (uint64_t i = 0; i < m_nPairs; ++i) {
+                scheduleAndCancel();
+            }
+        });
+        benchmark::printResult(std::cout, "schedule/cancel", m_nPairs, elapsed);
+
+        m_pending.clear();
+        m_scheduler.reset();
+        Simulator::Destroy();
+    }
+
+    void
+    onTick(uint64_t remaining)
+    {
+        scheduleAndCancel();
+        if (remaining > 1) {
+            Simulator::Schedule(MicroSeconds(1), &SchedulerBenchmark::onTick, this, remaining - 1);
+        }
+    }
+
+    void
+    runSimulated()
+    {
+        ::ndn::DummyIoService io;
+        m_scheduler = make_unique<::ndn::Scheduler>(io);
+
+        Simulator::ScheduleNow(&SchedulerBenchmark::onTick, this, m_nPairs);
+        double elapsed = benchmark::timedRun([] { Simulator::Run(); });
+        benchmark::printResult(std::cout, "simulated schedule/cancel", m_nPairs, elapsed);
+
+        // one event per tick is the driver itself
+        uint64_t nEvents = Simulator::GetEventCount();
+        std::cout << "ns-3 events per pair (excluding the driver): "
+                  << static_cast<double>(nEvents - m_nPairs) / m_nPairs << "\n";
+
+        m_pending.clear();
+        m_scheduler.reset();
+        Simulator::Destroy();
+    }
+
+  private:
+    uint64_t m_nPairs = 1000000;
+    size_t m_window = 1000;
+
+    unique_ptr<::ndn::Scheduler> m_scheduler;
+    std::deque<EventId> m_pending;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::SchedulerBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-stack-install-benchmark.cpp
+//
+// Install time and resident memory per node of the NDN stack on a ring of --nodes nodes, with
+// the full NFD (management, RIB, internal faces) or with StackHelper::setDataPlaneOnly().
+// Resident memory is not returned to the system, so each profile needs its own run:
+//
+//     ./waf --run "ndn-stack-install-benchmark --nodes=10000"
+//     ./waf --run "ndn-stack-install-benchmark --nodes=10000 --dataPlaneOnly=1"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ndn-benchmark-helpers.hpp"
+
+#include <fstream>
+#include <unistd.h>
+
+namespace ns3 {
+namespace ndn {
+
+class StackInstallBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("nodes", "Number of nodes", m_nNodes);
+        cmd.AddValue("dataPlaneOnly", "Install only Forwarder and FaceTable", m_isDataPlaneOnly);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        NodeContainer nodes;
+        nodes.Create(m_nNodes);
+
+        PointToPointHelper p2p;
+        for (uint32_t i = 0; i < m_nNodes; ++i) {
+            p2p.Install(nodes.Get(i), nodes.Get((i + 1) % m_nNodes));
+        }
+
+        StackHelper ndnHelper;
+        if (m_isDataPlaneOnly) {
+            ndnHelper.setDataPlaneOnly();
+        }
+
+        size_t rssBefore = getResidentBytes();
+        double elapsed = benchmark::timedRun([&] { ndnHelper.Install(nodes); });
+        size_t rssAfter = getResidentBytes();
+
+        benchmark::printResult(std::cout, m_isDataPlaneOnly ? "install, data plane only" : "install, full NFD",
+                               m_nNodes, elapsed);
+        std::cout << "per node: " << elapsed / m_nNodes * 1e6 << " us, "
+                  << static_cast<double>(rssAfter - rssBefore) / m_nNodes / 1024 << " KiB resident\n";
+
+        Simulator::Destroy();
+        return 0;
+    }
+
+  private:
+    static size_t
+    getResidentBytes()
+    {
+        size_t size = 0;
+        size_t resident = 0;
+        std::ifstream statm("/proc/self/statm");
+        statm >> size >> resident;
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+
+  private:
+    uint32_t m_nNodes = 10000;
+    bool m_isDataPlaneOnly = false;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::StackInstallBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,143 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-strategy-choice-benchmark.cpp
+//
+// Effective strategy lookup for PIT entries in a deep name hierarchy. There are --choices top-level
+// prefixes, each with a StrategyChoice entry on itself and another one --depth/2 components
+// below it; PIT entries are --depth components below the top-level prefix. Compares the NameTree
+// longest-prefix walk with StrategyChoice::findEffectiveStrategy, whose result is cached on the
+// NameTree entries, right after a StrategyChoice change (cold) and in steady state (warm).
+//
+//     ./waf --run "ndn-strategy-choice-benchmark --choices=1000 --depth=10 --entries=100000 --rounds=10"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/best-route-strategy2.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/multicast-strategy.hpp"
+
+#include "ndn-benchmark-helpers.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class StrategyChoiceBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("choices", "Number of top-level prefixes with a StrategyChoice entry", m_nChoices);
+        cmd.AddValue("depth", "Number of components between a top-level prefix and a PIT entry", m_depth);
+        cmd.AddValue("entries", "Number of PIT entries", m_nEntries);
+        cmd.AddValue("rounds", "Number of lookups of every PIT entry", m_nRounds);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        nfd::FaceTable faceTable;
+        nfd::Forwarder forwarder(faceTable);
+        nfd::NameTree& nameTree = forwarder.getNameTree();
+        nfd::StrategyChoice& sc = forwarder.getStrategyChoice();
+
+        std::vector<Name> prefixes;
+        for (uint32_t i = 0; i < m_nChoices; ++i) {
+            Name prefix("/root");
+            prefix.appendNumber(i);
+            Name deeper = prefix;
+            for (uint32_t d = 0; d < m_depth; ++d) {
+                prefix.append("level" + std::to_string(d));
+                if (d + 1 == m_depth / 2) {
+                    deeper = prefix;
+                }
+            }
+            prefixes.push_back(prefix);
+
+            sc.insert(Name("/root").appendNumber(i), nfd::fw::MulticastStrategy::getStrategyName());
+            if (m_depth >= 2) {
+                sc.insert(deeper, nfd::fw::BestRouteStrategy2::getStrategyName());
+            }
+        }
+
+        std::vector<shared_ptr<Interest>> interests;
+        std::vector<shared_ptr<nfd::pit::Entry>> pitEntries;
+        for (uint64_t i = 0; i < m_nEntries; ++i) {
+            auto interest = make_shared<Interest>(Name(prefixes[i % m_nChoices]).appendSequenceNumber(i));
+            interests.push_back(interest);
+            pitEntries.push_back(forwarder.getPit().insert(*interest).first);
+        }
+        std::cout << sc.size() << " StrategyChoice entries, " << nameTree.size() << " NameTree entries\n";
+
+        // 原来的实现: 每次都沿 NameTree 向上查找有 StrategyChoice 条目的前缀
+        std::vector<nfd::fw::Strategy*> expected(m_nEntries);
+        double seconds = benchmark::timedRun([&] {
+            for (uint32_t r = 0; r < m_nRounds; ++r) {
+                for (uint64_t i = 0; i < m_nEntries; ++i) {
+                    const nfd::name_tree::Entry* nte = nameTree.findLongestPrefixMatch(
+                      *pitEntries[i], [](const nfd::name_tree::Entry& e) { return e.getStrategyChoiceEntry() != nullptr; });
+                    expected[i] = &nte->getStrategyChoiceEntry()->getStrategy();
+                }
+            }
+        });
+        benchmark::printResult(std::cout, "NameTree walk", m_nEntries * m_nRounds, seconds);
+
+        // 改变 StrategyChoice 使所有缓存失效, 然后测量第一轮查找
+        sc.insert("/unused", nfd::fw::MulticastStrategy::getStrategyName());
+        uint64_t nMismatches = 0;
+        seconds = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nEntries; ++i) {
+                nMismatches += &sc.findEffectiveStrategy(*pitEntries[i]) != expected[i];
+            }
+        });
+        benchmark::printResult(std::cout, "findEffectiveStrategy, cold", m_nEntries, seconds);
+
+        seconds = benchmark::timedRun([&] {
+            for (uint32_t r = 0; r < m_nRounds; ++r) {
+                for (uint64_t i = 0; i < m_nEntries; ++i) {
+                    nMismatches += &sc.findEffectiveStrategy(*pitEntries[i]) != expected[i];
+                }
+            }
+        });
+        benchmark::printResult(std::cout, "findEffectiveStrategy, warm", m_nEntries * m_nRounds, seconds);
+
+        if (nMismatches > 0) {
+            std::cerr << nMismatches << " lookups returned a different strategy\n";
+            return 1;
+        }
+        return 0;
+    }
+
+  private:
+    uint32_t m_nChoices = 1000;
+    uint32_t m_depth = 10;
+    uint64_t m_nEntries = 100000;
+    uint32_t m_nRounds = 10;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::StrategyChoiceBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
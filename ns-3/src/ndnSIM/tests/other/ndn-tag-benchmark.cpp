@@ -0,0 +1,117 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+// ndn-tag-benchmark.cpp
+//
+// Packet tag handling of one forwarding hop: a newly decoded packet gets HopCountTag and
+// IncomingFaceIdTag, the forwarder reads them, the CS path removes HopCountTag, and the packet
+// is destroyed. Reports time and heap allocations per hop (counted by replacing the global
+// operator new) for a std::map tag store as TagHost used to have, and for TagHost with tags
+// created by make_shared and by ndn::makeTag.
+//
+//     ./waf --run "ndn-tag-benchmark --hops=10000000"
+
+#include "ns3/core-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include <ndn-cxx/detail/tag-host.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#define NDN_BENCHMARK_COUNT_ALLOCATIONS
+#include "ndn-benchmark-helpers.hpp"
+
+#include <map>
+
+namespace ns3 {
+namespace ndn {
+
+class TagBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("hops", "Number of packet hops", m_nHops);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        uint64_t sum = 0;
+
+        runHops("std::map, make_shared", [&](uint64_t i) {
+            std::map<int, shared_ptr<::ndn::Tag>> tags;
+            tags[::ndn::lp::HopCountTag::getTypeId()] = make_shared<::ndn::lp::HopCountTag>(i);
+            tags[::ndn::lp::IncomingFaceIdTag::getTypeId()] = make_shared<::ndn::lp::IncomingFaceIdTag>(i);
+            sum += static_pointer_cast<::ndn::lp::HopCountTag>(tags.find(::ndn::lp::HopCountTag::getTypeId())->second)->get();
+            sum += static_pointer_cast<::ndn::lp::IncomingFaceIdTag>(tags.find(::ndn::lp::IncomingFaceIdTag::getTypeId())->second)->get();
+            tags.erase(::ndn::lp::HopCountTag::getTypeId());
+        });
+
+        runHops("TagHost, make_shared", [&](uint64_t i) {
+            ::ndn::TagHost host;
+            host.setTag(make_shared<::ndn::lp::HopCountTag>(i));
+            host.setTag(make_shared<::ndn::lp::IncomingFaceIdTag>(i));
+            sum += host.getTag<::ndn::lp::HopCountTag>()->get();
+            sum += host.getTag<::ndn::lp::IncomingFaceIdTag>()->get();
+            host.removeTag<::ndn::lp::HopCountTag>();
+        });
+
+        runHops("TagHost, makeTag", [&](uint64_t i) {
+            ::ndn::TagHost host;
+            host.setTag(::ndn::makeTag<::ndn::lp::HopCountTag>(i));
+            host.setTag(::ndn::makeTag<::ndn::lp::IncomingFaceIdTag>(i));
+            sum += host.getTag<::ndn::lp::HopCountTag>()->get();
+            sum += host.getTag<::ndn::lp::IncomingFaceIdTag>()->get();
+            host.removeTag<::ndn::lp::HopCountTag>();
+        });
+
+        std::cout << "checksum: " << sum << "\n";
+        return 0;
+    }
+
+  private:
+    template<typename F>
+    void
+    runHops(const std::string& name, const F& hop)
+    {
+        uint64_t nAllocations = benchmark::g_nAllocations;
+        double seconds = benchmark::timedRun([&] {
+            for (uint64_t i = 0; i < m_nHops; ++i) {
+                hop(i);
+            }
+        });
+        nAllocations = benchmark::g_nAllocations - nAllocations;
+
+        benchmark::printResult(std::cout, name, m_nHops, seconds);
+        std::cout << "\t" << static_cast<double>(nAllocations) / m_nHops << " allocations/hop\n";
+    }
+
+  private:
+    uint64_t m_nHops = 10000000;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::TagBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
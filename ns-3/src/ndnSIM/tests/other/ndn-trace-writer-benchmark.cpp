@@ -0,0 +1,148 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+// ndn-trace-writer-benchmark.cpp
+//
+// Wall-clock time of a traced simulation with the trace files written synchronously and with
+// NdnAsyncTraceWriter (AsyncTraceStream on a background thread). L3RateTracer and CsTracer are
+// installed on all nodes of a --size x --size grid with a short --period, so that the
+// simulation produces a lot of trace output. The timed part includes Destroy() of the tracers,
+// i.e., the async run also pays for writing out whatever is still queued.
+//
+//     ./waf --run "ndn-trace-writer-benchmark --size=10 --period=0.01 --duration=20 --file=/tmp/trace"
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ndnSIM-module.h"
+
+#include "ndn-benchmark-helpers.hpp"
+
+#include <boost/filesystem.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+class TraceWriterBenchmark {
+  public:
+    int
+    run(int argc, char* argv[])
+    {
+        CommandLine cmd;
+        cmd.AddValue("size", "Grid size (nodes per side)", m_size);
+        cmd.AddValue("period", "Averaging period of the tracers (seconds)", m_period);
+        cmd.AddValue("duration", "Simulated time of every run (seconds)", m_duration);
+        cmd.AddValue("file", "Prefix of the trace files", m_file);
+        cmd.AddValue("binary", "Use TraceFormat::Binary", m_isBinary);
+        cmd.Parse(argc, argv);
+
+        benchmark::warnIfDebug();
+
+        runScenario(false);
+        runScenario(true);
+        return 0;
+    }
+
+  private:
+    void
+    runScenario(bool isAsync)
+    {
+        GlobalValue::Bind("NdnAsyncTraceWriter", BooleanValue(isAsync));
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("1Gbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("1000p"));
+
+        NodeContainer nodes;
+        nodes.Create(m_size * m_size);
+        auto gridNode = [&](uint32_t row, uint32_t col) { return nodes.Get(row * m_size + col); };
+
+        PointToPointHelper p2p;
+        for (uint32_t row = 0; row < m_size; ++row) {
+            for (uint32_t col = 0; col < m_size; ++col) {
+                if (col + 1 < m_size) {
+                    p2p.Install(gridNode(row, col), gridNode(row, col + 1));
+                }
+                if (row + 1 < m_size) {
+                    p2p.Install(gridNode(row, col), gridNode(row + 1, col));
+                }
+            }
+        }
+
+        StackHelper ndnHelper;
+        ndnHelper.InstallAll();
+
+        StrategyChoiceHelper::InstallAll("/prefix", "/localhost/nfd/strategy/best-route");
+
+        GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+
+        for (uint32_t i = 0; i < m_size; ++i) {
+            AppHelper consumerHelper("ns3::ndn::ConsumerCbr");
+            consumerHelper.SetPrefix("/prefix/" + std::to_string(i));
+            consumerHelper.SetAttribute("Frequency", StringValue("100"));
+            consumerHelper.Install(gridNode(i, 0));
+        }
+
+        Ptr<Node> producer = gridNode(m_size - 1, m_size - 1);
+        AppHelper producerHelper("ns3::ndn::Producer");
+        producerHelper.SetPrefix("/prefix");
+        producerHelper.SetAttribute("PayloadSize", StringValue("1024"));
+        producerHelper.Install(producer);
+
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", producer);
+        GlobalRoutingHelper::CalculateRoutes();
+
+        TraceFormat format = m_isBinary ? TraceFormat::Binary : TraceFormat::Text;
+        std::string rateFile = m_file + "-rate" + (isAsync ? "-async" : "");
+        std::string csFile = m_file + "-cs" + (isAsync ? "-async" : "");
+        L3RateTracer::InstallAll(rateFile, Seconds(m_period), format);
+        CsTracer::InstallAll(csFile, Seconds(m_period), format);
+
+        Simulator::Stop(Seconds(m_duration));
+        double seconds = benchmark::timedRun([] {
+            Simulator::Run();
+            L3RateTracer::Destroy();
+            CsTracer::Destroy();
+        });
+
+        uint64_t nBytes = boost::filesystem::file_size(rateFile) + boost::filesystem::file_size(csFile);
+        benchmark::printResult(std::cout, isAsync ? "async trace writer" : "synchronous trace writer",
+                               Simulator::GetEventCount(), seconds);
+        std::cout << "trace bytes: " << nBytes << "\n";
+
+        Simulator::Destroy();
+        GlobalValue::Bind("NdnAsyncTraceWriter", BooleanValue(false));
+    }
+
+  private:
+    uint32_t m_size = 10;
+    double m_period = 0.01;
+    double m_duration = 20;
+    std::string m_file = "trace-writer-benchmark";
+    bool m_isBinary = false;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+int
+main(int argc, char* argv[])
+{
+    ns3::ndn::TraceWriterBenchmark benchmark;
+    return benchmark.run(argc, argv);
+}
@@ -0,0 +1,193 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/cs.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+class CsFixture : public CleanupFixture {
+  public:
+    CsFixture()
+      : cs(100)
+    {
+    }
+
+    shared_ptr<Data>
+    insert(const Name& name, uint64_t content = 0)
+    {
+        auto data = make_shared<Data>(name);
+        data->setContent(::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::Content, content));
+        data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                            ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+        data->wireEncode();
+        cs.insert(*data);
+        return data;
+    }
+
+    /** \return name of the Data found for \p interest, or an empty name if there is no match
+     */
+    Name
+    find(const Interest& interest)
+    {
+        Name found;
+        cs.find(interest, [&](const Interest&, const Data& data) { found = data.getFullName(); },
+                [](const Interest&) {});
+        return found;
+    }
+
+    Name
+    findExact(const Name& name)
+    {
+        Interest interest(name);
+        interest.setCanBePrefix(false);
+        return find(interest);
+    }
+
+  public:
+    nfd::Cs cs;
+};
+
+BOOST_FIXTURE_TEST_SUITE(TestCs, CsFixture)
+
+BOOST_AUTO_TEST_CASE(ExactMatch)
+{
+    auto a1 = insert("/A/1");
+    auto a2 = insert("/A/2");
+    auto a1x = insert("/A/1/x");
+
+    BOOST_CHECK_EQUAL(findExact("/A/1"), a1->getFullName());
+    BOOST_CHECK_EQUAL(findExact("/A/2"), a2->getFullName());
+    BOOST_CHECK_EQUAL(findExact("/A/1/x"), a1x->getFullName());
+    BOOST_CHECK_EQUAL(findExact("/A"), Name());
+    BOOST_CHECK_EQUAL(findExact("/A/3"), Name());
+
+    // full names still go through the ordered table
+    BOOST_CHECK_EQUAL(findExact(a2->getFullName()), a2->getFullName());
+
+    Interest prefixInterest("/A");
+    prefixInterest.setCanBePrefix(true);
+    BOOST_CHECK_EQUAL(find(prefixInterest), a1->getFullName());
+}
+
+BOOST_AUTO_TEST_CASE(SameNameDifferentDigest)
+{
+    auto d1 = insert("/A", 1);
+    auto d2 = insert("/A", 2);
+    BOOST_CHECK_EQUAL(cs.size(), 2);
+
+    // same answer as the ordered lookup: the smallest full name
+    Name expected = std::min(d1->getFullName(), d2->getFullName());
+    BOOST_CHECK_EQUAL(findExact("/A"), expected);
+}
+
+BOOST_AUTO_TEST_CASE(Refresh)
+{
+    for (size_t payloadSize : {0, 1024}) {
+        cs.erase("/", 100, [](size_t) {});
+
+        // the same packet arriving twice, decoded from separate buffers
+        auto data = make_shared<Data>("/A");
+        data->setContent(make_shared<::ndn::Buffer>(payloadSize));
+        data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                            ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+        Block wire = data->wireEncode();
+        auto copy1 = make_shared<Data>(Block(wire.wire(), wire.size()));
+        auto copy2 = make_shared<Data>(Block(wire.wire(), wire.size()));
+
+        cs.insert(*copy1);
+        cs.insert(*copy2);
+        BOOST_CHECK_EQUAL(cs.size(), 1);
+        BOOST_CHECK(cs.begin()->isSamePacket(nfd::cs::Entry(copy2, false)));
+
+        // a different packet with the same name is a separate entry
+        insert("/A", 7);
+        BOOST_CHECK_EQUAL(cs.size(), 2);
+        BOOST_CHECK_EQUAL(findExact(data->getFullName()), data->getFullName());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Eviction)
+{
+    for (int i = 0; i < 100; ++i) {
+        insert(Name("/A").appendNumber(i));
+    }
+    BOOST_CHECK_EQUAL(cs.size(), 100);
+
+    // LRU evicts the entries inserted first
+    cs.setLimit(10);
+    BOOST_CHECK_EQUAL(cs.size(), 10);
+    for (int i = 0; i < 100; ++i) {
+        Name name = Name("/A").appendNumber(i);
+        BOOST_CHECK_EQUAL(findExact(name).empty(), i < 90);
+    }
+
+    cs.erase("/A", 5, [](size_t nErased) { BOOST_CHECK_EQUAL(nErased, 5); });
+    for (int i = 90; i < 100; ++i) {
+        Name name = Name("/A").appendNumber(i);
+        BOOST_CHECK_EQUAL(findExact(name).empty(), i < 95);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(VirtualPayload)
+{
+    auto data = make_shared<Data>("/A/1");
+    data->setContent(make_shared<::ndn::Buffer>(1024));
+    data->setSignature(::ndn::Signature(::ndn::SignatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255)),
+                                        ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 0)));
+    Block wire = data->wireEncode();
+    Name fullName = data->getFullName();
+    cs.insert(*data);
+
+    BOOST_REQUIRE_EQUAL(cs.size(), 1);
+    const nfd::cs::Entry& entry = *cs.begin();
+    BOOST_CHECK(entry.hasVirtualPayload());
+    BOOST_CHECK_EQUAL(entry.getFullName(), fullName);
+
+    // the Data served from the CS has the original encoding
+    shared_ptr<const Data> found;
+    Interest interest("/A/1");
+    interest.setCanBePrefix(false);
+    cs.find(interest, [&](const Interest&, const Data& data) { found = data.shared_from_this(); },
+            [](const Interest&) {});
+    BOOST_REQUIRE(found != nullptr);
+    BOOST_CHECK(found->wireEncode() == wire);
+    BOOST_CHECK_EQUAL(found->getContent().value_size(), 1024);
+    // and is shared while it is in use, but not kept by the entry
+    BOOST_CHECK_EQUAL(entry.getData(), found);
+    std::weak_ptr<const Data> served = found;
+    found.reset();
+    BOOST_CHECK(served.expired());
+
+    BOOST_CHECK_EQUAL(findExact(fullName), fullName);
+
+    // non-zero content is stored as is
+    auto a2 = insert("/A/2", 2);
+    auto entry2 = std::find_if(cs.begin(), cs.end(), [](const auto& entry) { return entry.getName() == "/A/2"; });
+    BOOST_REQUIRE(entry2 != cs.end());
+    BOOST_CHECK(!entry2->hasVirtualPayload());
+    BOOST_CHECK_EQUAL(entry2->getData(), a2);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,95 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/dead-nonce-list.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestDeadNonceList, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Basic)
+{
+    nfd::DeadNonceList dnl;
+    BOOST_CHECK_EQUAL(dnl.size(), 0);
+    BOOST_CHECK(!dnl.has("/A", 1));
+
+    dnl.add("/A", 1);
+    BOOST_CHECK_EQUAL(dnl.size(), 1);
+    BOOST_CHECK(dnl.has("/A", 1));
+    BOOST_CHECK(!dnl.has("/A", 2));
+    BOOST_CHECK(!dnl.has("/B", 1));
+    BOOST_CHECK(!dnl.has("/A/B", 1));
+
+    // 重复添加的 name+nonce 按两个条目计数
+    dnl.add("/A", 1);
+    BOOST_CHECK_EQUAL(dnl.size(), 2);
+    BOOST_CHECK(dnl.has("/A", 1));
+
+    // 名字的哈希与组件顺序有关
+    dnl.add("/A/B", 1);
+    BOOST_CHECK(dnl.has("/A/B", 1));
+    BOOST_CHECK(!dnl.has("/B/A", 1));
+}
+
+BOOST_AUTO_TEST_CASE(EvictOldest)
+{
+    nfd::DeadNonceList dnl;
+    for (uint32_t i = 0; i < 10000; ++i) {
+        dnl.add(Name("/A").appendSequenceNumber(i), i);
+    }
+
+    // 不运行模拟器时容量不变, 最早的条目已被淘汰, 最近的条目仍然存在
+    BOOST_CHECK_LT(dnl.size(), 10000);
+    BOOST_CHECK(!dnl.has(Name("/A").appendSequenceNumber(0), 0));
+    BOOST_CHECK(!dnl.has(Name("/A").appendSequenceNumber(5000), 5000));
+    for (uint32_t i = 10000 - dnl.size(); i < 10000; ++i) {
+        BOOST_REQUIRE(dnl.has(Name("/A").appendSequenceNumber(i), i));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+    nfd::DeadNonceList dnl(time::milliseconds(100));
+
+    // 每 1ms 添加一个条目, 容量应收敛到约 100 个条目
+    uint32_t nAdded = 0;
+    for (int t = 0; t < 5000; ++t) {
+        nfd::getScheduler().schedule(time::milliseconds(t), [&dnl, &nAdded] {
+            dnl.add(Name("/A").appendSequenceNumber(nAdded), nAdded);
+            ++nAdded;
+        });
+    }
+    Simulator::Stop(MilliSeconds(5000));
+    Simulator::Run();
+
+    BOOST_REQUIRE_EQUAL(nAdded, 5000);
+    BOOST_CHECK_GT(dnl.size(), 25);
+    BOOST_CHECK_LT(dnl.size(), 400);
+    BOOST_CHECK(dnl.has(Name("/A").appendSequenceNumber(4990), 4990));
+    BOOST_CHECK(!dnl.has(Name("/A").appendSequenceNumber(4000), 4000));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,115 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/face/null-face.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/multicast-strategy.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestForwarder, CleanupFixture)
+
+class ForwarderWithFaces {
+  public:
+    ForwarderWithFaces()
+      : forwarder(faceTable)
+    {
+        for (int i = 0; i < 4; ++i) {
+            faces.push_back(nfd::face::makeNullFace());
+            faceTable.add(faces.back());
+        }
+
+        // faces[2] 和 faces[3] 是上游; /prefix/A/x 下使用 multicast, 其余使用默认的 best-route
+        nfd::fib::Entry& fibEntry = *forwarder.getFib().insert("/prefix").first;
+        forwarder.getFib().addOrUpdateNextHop(fibEntry, *faces[2], 10);
+        forwarder.getFib().addOrUpdateNextHop(fibEntry, *faces[3], 20);
+        forwarder.getStrategyChoice().insert("/prefix/A/x", nfd::fw::MulticastStrategy::getStrategyName());
+
+        for (const char* name : {"/prefix/A/1", "/prefix/A/x/1", "/prefix/A/2", "/prefix/A/x/2", "/prefix/A/1"}) {
+            auto interest = make_shared<Interest>(name);
+            interest->setNonce(static_cast<uint32_t>(interests.size() + 1));
+            interests.push_back(interest);
+        }
+    }
+
+  public:
+    nfd::FaceTable faceTable;
+    nfd::Forwarder forwarder;
+    std::vector<shared_ptr<nfd::Face>> faces;
+    std::vector<shared_ptr<Interest>> interests;
+};
+
+BOOST_AUTO_TEST_CASE(ProcessInterestsBatch)
+{
+    ForwarderWithFaces batched;
+    std::vector<nfd::Forwarder::IncomingInterest> batch;
+    for (size_t i = 0; i < batched.interests.size(); ++i) {
+        batch.push_back({nfd::FaceEndpoint(*batched.faces[i % 2], 0), *batched.interests[i]});
+    }
+    batched.forwarder.startProcessInterests(batch);
+
+    const auto& counters = batched.forwarder.getCounters();
+    BOOST_CHECK_EQUAL(counters.nInInterests, 5);
+    BOOST_CHECK_EQUAL(batched.forwarder.getPit().size(), 4);
+    // best-route: /prefix/A/1 一次, /prefix/A/2 一次; multicast: /prefix/A/x/1 和 /prefix/A/x/2 各两次;
+    // 第二个 /prefix/A/1 是同一 face 的重传, 被 PIT 聚合, best-route 在重传抑制期内不转发
+    BOOST_CHECK_EQUAL(counters.nOutInterests, 6);
+
+    // 与逐个处理的结果相同
+    ForwarderWithFaces single;
+    for (size_t i = 0; i < single.interests.size(); ++i) {
+        single.forwarder.startProcessInterest(nfd::FaceEndpoint(*single.faces[i % 2], 0), *single.interests[i]);
+    }
+    BOOST_CHECK_EQUAL(single.forwarder.getCounters().nInInterests, counters.nInInterests);
+    BOOST_CHECK_EQUAL(single.forwarder.getCounters().nOutInterests, counters.nOutInterests);
+    BOOST_CHECK_EQUAL(single.forwarder.getPit().size(), batched.forwarder.getPit().size());
+}
+
+BOOST_AUTO_TEST_CASE(StrategyChangeBetweenBatches)
+{
+    ForwarderWithFaces fwd;
+    std::vector<shared_ptr<Interest>> interests;
+    auto processBatch = [&](std::initializer_list<const char*> names) {
+        std::vector<nfd::Forwarder::IncomingInterest> batch;
+        for (const char* name : names) {
+            interests.push_back(make_shared<Interest>(name));
+            interests.back()->setNonce(static_cast<uint32_t>(100 + interests.size()));
+            batch.push_back({nfd::FaceEndpoint(*fwd.faces[interests.size() % 2], 0), *interests.back()});
+        }
+        fwd.forwarder.startProcessInterests(batch);
+    };
+
+    // best-route: 每个兴趣包转发一次
+    processBatch({"/prefix/B/1", "/prefix/B/2"});
+    BOOST_CHECK_EQUAL(fwd.forwarder.getCounters().nOutInterests, 2);
+
+    // 上一批缓存在 NameTree 上的有效策略不能在 StrategyChoice 改变后继续使用;
+    // multicast: 每个兴趣包转发到两个上游
+    fwd.forwarder.getStrategyChoice().insert("/prefix/B", nfd::fw::MulticastStrategy::getStrategyName());
+    processBatch({"/prefix/B/3", "/prefix/B/4"});
+    BOOST_CHECK_EQUAL(fwd.forwarder.getCounters().nOutInterests, 6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,77 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/NFD/daemon/table/measurements.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_FIXTURE_TEST_SUITE(TestMeasurements, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(Lifetime)
+{
+    nfd::NameTree nameTree;
+    nfd::Measurements measurements(nameTree);
+    auto& scheduler = nfd::getScheduler();
+
+    // 两个条目都在 4s 过期
+    nfd::measurements::Entry& entryA = measurements.get("/A");
+    measurements.get("/B");
+    BOOST_CHECK_EQUAL(measurements.size(), 2);
+
+    // 在 1s 时将 /A 延长到 10s, 延长寿命不产生调度器操作
+    scheduler.schedule(time::seconds(1), [&] {
+        uint64_t nScheduled = scheduler.getNScheduledEvents();
+        uint64_t nCanceled = scheduler.getNCanceledEvents();
+        for (int i = 0; i < 100; ++i) {
+            measurements.extendLifetime(entryA, time::seconds(9));
+        }
+        // 更短的寿命不会缩短已有的寿命
+        measurements.extendLifetime(entryA, time::seconds(2));
+        BOOST_CHECK_EQUAL(scheduler.getNScheduledEvents(), nScheduled);
+        BOOST_CHECK_EQUAL(scheduler.getNCanceledEvents(), nCanceled);
+    });
+
+    scheduler.schedule(time::milliseconds(3999), [&] {
+        BOOST_CHECK(measurements.findExactMatch("/B") != nullptr);
+    });
+    scheduler.schedule(time::milliseconds(4001), [&] {
+        BOOST_CHECK(measurements.findExactMatch("/A") != nullptr);
+        BOOST_CHECK(measurements.findExactMatch("/B") == nullptr);
+        BOOST_CHECK_EQUAL(measurements.size(), 1);
+    });
+    scheduler.schedule(time::milliseconds(9999), [&] {
+        BOOST_CHECK(measurements.findExactMatch("/A") != nullptr);
+    });
+    scheduler.schedule(time::milliseconds(10001), [&] {
+        BOOST_CHECK(measurements.findExactMatch("/A") == nullptr);
+        BOOST_CHECK_EQUAL(measurements.size(), 0);
+    });
+
+    Simulator::Run();
+    BOOST_CHECK_EQUAL(Simulator::Now(), MilliSeconds(10001));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
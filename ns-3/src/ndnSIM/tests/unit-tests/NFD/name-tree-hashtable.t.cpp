@@ -0,0 +1,98 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/table/name-tree-hashtable.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::name_tree::computeHash;
+using nfd::name_tree::computeHashes;
+using nfd::name_tree::HashSequence;
+
+BOOST_AUTO_TEST_SUITE(TestNameTreeHashtable)
+
+static HashSequence
+computeUncached(const Name& name)
+{
+    HashSequence seq;
+    for (size_t i = 0; i <= name.size(); ++i) {
+        seq.push_back(computeHash(Name(name.wireEncode()), i));
+    }
+    return seq;
+}
+
+BOOST_AUTO_TEST_CASE(Memoized)
+{
+    Name name("/A/B/C/D");
+    BOOST_CHECK(name.getPrefixHashes() == nullptr);
+
+    const HashSequence& hashes = computeHashes(name, 2);
+    BOOST_REQUIRE(name.getPrefixHashes() == &hashes);
+    BOOST_CHECK_EQUAL(hashes.size(), 3);
+    BOOST_CHECK_EQUAL(hashes[0], 0);
+
+    // a longer request extends the memoized sequence
+    const HashSequence& all = computeHashes(name);
+    BOOST_CHECK_EQUAL(all.size(), 5);
+    HashSequence expected = computeUncached(name);
+    BOOST_CHECK_EQUAL_COLLECTIONS(all.begin(), all.end(), expected.begin(), expected.end());
+
+    // a shorter request reuses it
+    BOOST_CHECK_EQUAL(&computeHashes(name, 1), &all);
+    for (size_t i = 0; i <= name.size(); ++i) {
+        BOOST_CHECK_EQUAL(computeHash(name, i), expected[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Modification)
+{
+    Name name("/A/B/C");
+    computeHashes(name);
+
+    Name copy(name);
+    BOOST_CHECK(copy.getPrefixHashes() == name.getPrefixHashes());
+
+    name.append("D");
+    BOOST_CHECK(name.getPrefixHashes() != nullptr);
+    HashSequence expected = computeUncached(name);
+    const HashSequence& extended = computeHashes(name);
+    BOOST_CHECK_EQUAL_COLLECTIONS(extended.begin(), extended.end(), expected.begin(), expected.end());
+
+    name.set(1, ::ndn::name::Component("X"));
+    BOOST_CHECK(name.getPrefixHashes() == nullptr);
+    computeHashes(name);
+    name.erase(-1);
+    BOOST_CHECK(name.getPrefixHashes() == nullptr);
+    computeHashes(name);
+    name.clear();
+    BOOST_CHECK(name.getPrefixHashes() == nullptr);
+
+    // the copy is unaffected
+    expected = computeUncached(copy);
+    const HashSequence& copyHashes = computeHashes(copy);
+    BOOST_CHECK_EQUAL_COLLECTIONS(copyHashes.begin(), copyHashes.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,59 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/scope-prefix.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using namespace nfd::scope_prefix;
+
+BOOST_AUTO_TEST_SUITE(TestScopePrefix)
+
+BOOST_AUTO_TEST_CASE(Localhost)
+{
+    BOOST_CHECK(isLocalhost("/localhost"));
+    BOOST_CHECK(isLocalhost("/localhost/nfd/faces/list"));
+    BOOST_CHECK(isLocalhost("/localhost/prefix"));
+    BOOST_CHECK(!isLocalhost("/"));
+    BOOST_CHECK(!isLocalhost("/localhop/nfd"));
+    BOOST_CHECK(!isLocalhost("/prefix/localhost"));
+    BOOST_CHECK(!isLocalhost("/localhostX"));
+
+    for (const auto& name : {"/", "/localhost", "/localhost/A", "/A/localhost", "/localhop"}) {
+        BOOST_CHECK_EQUAL(isLocalhost(name), LOCALHOST.isPrefixOf(name));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(LocalhostNfd)
+{
+    BOOST_CHECK(isLocalhostNfd("/localhost/nfd"));
+    BOOST_CHECK(isLocalhostNfd("/localhost/nfd/rib/register"));
+    BOOST_CHECK(!isLocalhostNfd("/localhost"));
+    BOOST_CHECK(!isLocalhostNfd("/localhost/nfdX"));
+    BOOST_CHECK(!isLocalhostNfd("/localhop/nfd"));
+    BOOST_CHECK(!isLocalhostNfd("/prefix/localhost/nfd"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
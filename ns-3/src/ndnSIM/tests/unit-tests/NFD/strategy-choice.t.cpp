@@ -0,0 +1,92 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/NFD/daemon/fw/best-route-strategy2.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/multicast-strategy.hpp"
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using nfd::fw::BestRouteStrategy2;
+using nfd::fw::MulticastStrategy;
+
+BOOST_FIXTURE_TEST_SUITE(TestStrategyChoice, CleanupFixture)
+
+BOOST_AUTO_TEST_CASE(EffectiveStrategyCache)
+{
+    nfd::FaceTable faceTable;
+    nfd::Forwarder forwarder(faceTable);
+    nfd::StrategyChoice& sc = forwarder.getStrategyChoice();
+
+    auto findEffectiveStrategy = [&](const Name& name) -> const Name& {
+        return sc.findEffectiveStrategy(name).getInstanceName();
+    };
+
+    BOOST_REQUIRE(sc.insert("/A", MulticastStrategy::getStrategyName()));
+    // NameTree 中已有 /A/B/C/D, 查找会在各级条目上缓存结果
+    forwarder.getNameTree().lookup("/A/B/C/D");
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D"), MulticastStrategy::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D/E"), MulticastStrategy::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B"), MulticastStrategy::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/X/Y"), BestRouteStrategy2::getStrategyName());
+
+    // 缓存在插入和删除 StrategyChoice 条目后失效
+    BOOST_REQUIRE(sc.insert("/A/B", BestRouteStrategy2::getStrategyName()));
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D"), BestRouteStrategy2::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C"), BestRouteStrategy2::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/X"), MulticastStrategy::getStrategyName());
+
+    sc.erase("/A/B");
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D"), MulticastStrategy::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C"), MulticastStrategy::getStrategyName());
+
+    // 在同一前缀上更换策略
+    BOOST_REQUIRE(sc.insert("/A", BestRouteStrategy2::getStrategyName()));
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D"), BestRouteStrategy2::getStrategyName());
+
+    BOOST_REQUIRE(sc.insert("/A", MulticastStrategy::getStrategyName()));
+    sc.erase("/A");
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D"), BestRouteStrategy2::getStrategyName());
+    BOOST_CHECK_EQUAL(findEffectiveStrategy("/A/B/C/D/E"), BestRouteStrategy2::getStrategyName());
+}
+
+BOOST_AUTO_TEST_CASE(PitEntry)
+{
+    nfd::FaceTable faceTable;
+    nfd::Forwarder forwarder(faceTable);
+    nfd::StrategyChoice& sc = forwarder.getStrategyChoice();
+
+    auto interest = make_shared<Interest>("/A/B/C");
+    shared_ptr<nfd::pit::Entry> pitEntry = forwarder.getPit().insert(*interest).first;
+    BOOST_CHECK_EQUAL(sc.findEffectiveStrategy(*pitEntry).getInstanceName(), BestRouteStrategy2::getStrategyName());
+
+    BOOST_REQUIRE(sc.insert("/A/B", MulticastStrategy::getStrategyName()));
+    BOOST_CHECK_EQUAL(sc.findEffectiveStrategy(*pitEntry).getInstanceName(), MulticastStrategy::getStrategyName());
+
+    BOOST_REQUIRE(sc.insert("/A/B/C", BestRouteStrategy2::getStrategyName()));
+    BOOST_CHECK_EQUAL(sc.findEffectiveStrategy(*pitEntry).getInstanceName(), BestRouteStrategy2::getStrategyName());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
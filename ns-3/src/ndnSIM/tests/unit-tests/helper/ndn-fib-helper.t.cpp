@@ -18,6 +18,10 @@
  **/
 
 #include "helper/ndn-fib-helper.hpp"
+#include "model/ndn-l3-protocol.hpp"
+
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/rib/service.hpp"
 
 #include "../tests-common.hpp"
 
@@ -41,12 +45,16 @@ class AddRouteFixture : public ScenarioHelperWithCleanupFixture {
         Simulator::Stop(Seconds(20.101));
         Simulator::Run();
 
-        BOOST_CHECK_EQUAL(getFace("1", "2")->getCounters().nOutInterests, 10);
-        BOOST_CHECK_EQUAL(getFace("1", "2")->getCounters().nInData, 10);
+        BOOST_CHECK_EQUAL(getFace("1", "2")->getCounters().nOutInterests, nExpectedInterests);
+        BOOST_CHECK_EQUAL(getFace("1", "2")->getCounters().nInData, nExpectedInterests);
 
-        BOOST_CHECK_EQUAL(getFace("2", "1")->getCounters().nInInterests, 10);
-        BOOST_CHECK_EQUAL(getFace("2", "1")->getCounters().nOutData, 10);
+        BOOST_CHECK_EQUAL(getFace("2", "1")->getCounters().nInInterests, nExpectedInterests);
+        BOOST_CHECK_EQUAL(getFace("2", "1")->getCounters().nOutData, nExpectedInterests);
     }
+
+  public:
+    // the Interest sent at 0s is not forwarded when the route is registered through a command
+    size_t nExpectedInterests = 10;
 };
 
 BOOST_FIXTURE_TEST_SUITE(AddRoute, AddRouteFixture)
@@ -87,6 +95,46 @@ BOOST_AUTO_TEST_CASE(Helper4)
     FibHelper::AddRoute(getNode("1"), Name("/prefix"), getNode("2"), 10);
 }
 
+// static void
+// AddRoutes(Ptr<Node> node, const std::vector<Route>& routes, bool updateRib);
+BOOST_AUTO_TEST_CASE(Direct)
+{
+    // the route is in the FIB before the Interest sent at 0s
+    nExpectedInterests = 11;
+    FibHelper::AddRoutes(getNode("1"), {{Name("/prefix"), getFace("1", "2"), 10}});
+
+    auto ndn = getNode("1")->GetObject<L3Protocol>();
+    auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+    BOOST_CHECK_EQUAL(entry->getNextHops().front().getFace().getId(), getFace("1", "2")->getId());
+    BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 10);
+
+    auto& rib = ndn->getRibService().getRib();
+    BOOST_CHECK(rib.find("/prefix") == rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(DirectWithRib)
+{
+    nExpectedInterests = 11;
+    FibHelper::AddRoutes(getNode("1"), {{Name("/prefix"), getFace("1", "2"), 10},
+                                        {Name("/prefix"), getFace("1", "2"), 1}},
+                         true);
+
+    auto ndn = getNode("1")->GetObject<L3Protocol>();
+    auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+    BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 1);
+
+    auto& rib = ndn->getRibService().getRib();
+    auto ribEntry = rib.find("/prefix");
+    BOOST_REQUIRE(ribEntry != rib.end());
+    BOOST_REQUIRE_EQUAL(ribEntry->second->getRoutes().size(), 1);
+    BOOST_CHECK_EQUAL(ribEntry->second->getRoutes().front().faceId, getFace("1", "2")->getId());
+    BOOST_CHECK_EQUAL(ribEntry->second->getRoutes().front().cost, 1);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // AddRoute
 
 BOOST_AUTO_TEST_SUITE_END() // HelperNdnFibHelper
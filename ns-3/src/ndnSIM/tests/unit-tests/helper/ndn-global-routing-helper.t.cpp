@@ -33,6 +33,9 @@
 #include "ns3/point-to-point-module.h"
 #include "ns3/point-to-point-layout-module.h"
 
+#include "daemon/fw/forwarder.hpp"
+#include "daemon/rib/service.hpp"
+
 #include "../tests-common.hpp"
 
 #include <boost/filesystem.hpp>
@@ -189,6 +192,208 @@ BOOST_AUTO_TEST_CASE(CalculateRoutesBasedOnLinkDelay)
     }
 }
 
+BOOST_AUTO_TEST_CASE(CalculateRoutesDirect)
+{
+    ofstream file1(TEST_TOPO_TXT.string().c_str());
+    file1 << "router\n\n"
+          << "#node city  y x mpi-partition\n"
+          << "A4  NA  1 1 1\n"
+          << "B4  NA  80  -40 1\n"
+          << "C4  NA  80  40  1\n\n"
+          << "link\n\n"
+          << "# from  to  capacity  metric  delay queue\n"
+          << "A4      B4  10Mbps    100 1ms 100\n"
+          << "A4      C4  10Mbps    500  1ms 100\n"
+          << "B4      C4  10Mbps    1 1ms 100\n";
+    file1.close();
+
+    AnnotatedTopologyReader topologyReader("");
+    topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+    topologyReader.Read();
+
+    // Install NDN stack on all nodes
+    ndn::StackHelper ndnHelper;
+    ndnHelper.InstallAll();
+
+    topologyReader.ApplyOspfMetric();
+
+    ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+    ndnGlobalRoutingHelper.InstallAll();
+
+    ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C4"));
+    ndn::GlobalRoutingHelper::SetDirectFibInstallation(true, true);
+    ndn::GlobalRoutingHelper::CalculateRoutes();
+    ndn::GlobalRoutingHelper::SetDirectFibInstallation(false);
+
+    auto ndn = Names::Find<Node>("A4")->GetObject<ndn::L3Protocol>();
+    auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 1);
+    BOOST_CHECK_EQUAL(entry->getNextHops().front().getCost(), 101);
+
+    auto transport = dynamic_cast<NetDeviceTransport*>(entry->getNextHops().front().getFace().getTransport());
+    BOOST_REQUIRE(transport != nullptr);
+    BOOST_CHECK_EQUAL(Names::FindName(transport->GetNetDevice()->GetChannel()->GetDevice(1)->GetNode()), "B4");
+
+    auto& rib = ndn->getRibService().getRib();
+    BOOST_CHECK(rib.find("/prefix") != rib.end());
+}
+
+BOOST_AUTO_TEST_CASE(CalculateAllPossibleRoutes)
+{
+    ofstream file1(TEST_TOPO_TXT.string().c_str());
+    file1 << "router\n\n"
+          << "#node city  y x mpi-partition\n"
+          << "A5  NA  1 1 1\n"
+          << "B5  NA  80  -40 1\n"
+          << "C5  NA  80  40  1\n\n"
+          << "link\n\n"
+          << "# from  to  capacity  metric  delay queue\n"
+          << "A5      B5  10Mbps    100 1ms 100\n"
+          << "A5      C5  10Mbps    50  1ms 100\n"
+          << "B5      C5  10Mbps    1 1ms 100\n";
+    file1.close();
+
+    AnnotatedTopologyReader topologyReader("");
+    topologyReader.SetFileName(TEST_TOPO_TXT.string().c_str());
+    topologyReader.Read();
+
+    // Install NDN stack on all nodes
+    ndn::StackHelper ndnHelper;
+    ndnHelper.InstallAll();
+
+    topologyReader.ApplyOspfMetric();
+
+    ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+    ndnGlobalRoutingHelper.InstallAll();
+
+    ndnGlobalRoutingHelper.AddOrigins("/prefix", Names::Find<Node>("C5"));
+    ndn::GlobalRoutingHelper::SetRouteCalculationThreads(2);
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+    ndn::GlobalRoutingHelper::SetRouteCalculationThreads(0);
+
+    // the routes are registered through FIB management commands
+    Simulator::Stop(Seconds(1));
+    Simulator::Run();
+
+    auto ndn = Names::Find<Node>("A5")->GetObject<ndn::L3Protocol>();
+    auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+    BOOST_REQUIRE(entry != nullptr);
+    BOOST_REQUIRE_EQUAL(entry->getNextHops().size(), 2);
+
+    std::map<std::string, uint64_t> costs;
+    for (const auto& nextHop : entry->getNextHops()) {
+        auto transport = dynamic_cast<NetDeviceTransport*>(nextHop.getFace().getTransport());
+        BOOST_REQUIRE(transport != nullptr);
+        costs[Names::FindName(transport->GetNetDevice()->GetChannel()->GetDevice(1)->GetNode())] = nextHop.getCost();
+    }
+    BOOST_CHECK_EQUAL(costs["B5"], 101);
+    BOOST_CHECK_EQUAL(costs["C5"], 50);
+
+    // face metrics are left untouched
+    for (const auto& face : ndn->getFaceTable()) {
+        BOOST_CHECK_NE(face.getMetric(), std::numeric_limits<uint16_t>::max() - 1);
+    }
+}
+
+class RingTopologyFixture : public GlobalRoutingHelperFixture {
+  public:
+    // more nodes than route calculation processes in one block with a single thread
+    static const int N_NODES = 71;
+
+    RingTopologyFixture()
+    {
+        nodes.Create(N_NODES);
+        PointToPointHelper p2p;
+        for (int i = 0; i < N_NODES; ++i) {
+            p2p.Install(nodes.Get(i), nodes.Get((i + 1) % N_NODES));
+        }
+
+        ndn::StackHelper ndnHelper;
+        ndnHelper.InstallAll();
+
+        ndn::GlobalRoutingHelper ndnGlobalRoutingHelper;
+        ndnGlobalRoutingHelper.InstallAll();
+        ndnGlobalRoutingHelper.AddOrigins("/prefix", nodes.Get(0));
+
+        ndn::GlobalRoutingHelper::SetRouteCalculationThreads(1);
+        ndn::GlobalRoutingHelper::SetDirectFibInstallation(true);
+    }
+
+    ~RingTopologyFixture()
+    {
+        ndn::GlobalRoutingHelper::SetDirectFibInstallation(false);
+        ndn::GlobalRoutingHelper::SetRouteCalculationThreads(0);
+    }
+
+    /** \return cost of the route to /prefix from node \p i through its neighbor \p neighbor,
+     *          or -1 if there is none
+     */
+    int64_t
+    getCost(int i, int neighbor)
+    {
+        auto ndn = nodes.Get(i)->GetObject<ndn::L3Protocol>();
+        auto entry = ndn->getForwarder()->getFib().findExactMatch("/prefix");
+        if (entry == nullptr) {
+            return -1;
+        }
+        for (const auto& nextHop : entry->getNextHops()) {
+            // every next hop must be a face of this node
+            BOOST_REQUIRE(ndn->getFaceTable().get(nextHop.getFace().getId()) == &nextHop.getFace());
+            auto transport = dynamic_cast<NetDeviceTransport*>(nextHop.getFace().getTransport());
+            BOOST_REQUIRE(transport != nullptr);
+            Ptr<Channel> channel = transport->GetNetDevice()->GetChannel();
+            Ptr<Node> peer = channel->GetDevice(channel->GetDevice(0)->GetNode() == nodes.Get(i) ? 1 : 0)->GetNode();
+            if (peer == nodes.Get(neighbor)) {
+                return nextHop.getCost();
+            }
+        }
+        return -1;
+    }
+
+    size_t
+    getNNextHops(int i)
+    {
+        auto entry = nodes.Get(i)->GetObject<ndn::L3Protocol>()->getForwarder()->getFib().findExactMatch("/prefix");
+        return entry == nullptr ? 0 : entry->getNextHops().size();
+    }
+
+  public:
+    NodeContainer nodes;
+};
+
+BOOST_FIXTURE_TEST_CASE(CalculateRoutesRing, RingTopologyFixture)
+{
+    ndn::GlobalRoutingHelper::CalculateRoutes();
+
+    for (int i = 1; i < N_NODES; ++i) {
+        BOOST_TEST_CONTEXT("node " << i)
+        {
+            BOOST_CHECK_EQUAL(getNNextHops(i), 1);
+            if (i < N_NODES - i) {
+                BOOST_CHECK_EQUAL(getCost(i, i - 1), i);
+            }
+            else {
+                BOOST_CHECK_EQUAL(getCost(i, (i + 1) % N_NODES), N_NODES - i);
+            }
+        }
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE(CalculateAllPossibleRoutesRing, RingTopologyFixture)
+{
+    ndn::GlobalRoutingHelper::CalculateAllPossibleRoutes();
+
+    for (int i = 1; i < N_NODES; ++i) {
+        BOOST_TEST_CONTEXT("node " << i)
+        {
+            BOOST_CHECK_EQUAL(getNNextHops(i), 2);
+            BOOST_CHECK_EQUAL(getCost(i, i - 1), i);
+            BOOST_CHECK_EQUAL(getCost(i, (i + 1) % N_NODES), N_NODES - i);
+        }
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -62,6 +62,89 @@ BOOST_AUTO_TEST_CASE(TestNfdContentStorePolicy)
     BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getPolicy()->getName(), "priority_fifo");
 }
 
+BOOST_AUTO_TEST_CASE(TestNfdContentStoreDecisionPolicy)
+{
+    NodeContainer nodes;
+    nodes.Create(2);
+
+    PointToPointHelper p2p;
+    p2p.Install(nodes.Get(0), nodes.Get(1));
+
+    ndn::StackHelper ndnHelper;
+    ndnHelper.Install(nodes.Get(0));
+
+    // LCE is used unless another policy is selected
+    Ptr<L3Protocol> protoNode0 = L3Protocol::getL3Protocol(nodes.Get(0));
+    BOOST_CHECK_EQUAL(protoNode0->getForwarder()->getCs().getDecisionPolicy()->getName(), "lce");
+
+    ndnHelper.setCacheDecisionPolicy("lcd");
+    ndnHelper.Install(nodes.Get(1));
+
+    Ptr<L3Protocol> protoNode1 = L3Protocol::getL3Protocol(nodes.Get(1));
+    BOOST_CHECK_EQUAL(protoNode0->getForwarder()->getCs().getDecisionPolicy()->getName(), "lce");
+    BOOST_CHECK_EQUAL(protoNode1->getForwarder()->getCs().getDecisionPolicy()->getName(), "lcd");
+}
+
+class CacheDecisionFixture : public ScenarioHelperWithCleanupFixture {
+  public:
+    void
+    run(const std::string& policy)
+    {
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("1ms"));
+
+        getStackHelper().setCacheDecisionPolicy(policy);
+        createTopology({{"A1", "A2"}, {"A2", "A3"}, {"A3", "A4"}});
+
+        addRoutes({
+          {"A1", "A2", "/prefix", 1},
+          {"A2", "A3", "/prefix", 1},
+          {"A3", "A4", "/prefix", 1},
+        });
+
+        // the same 10 Data packets are requested twice; the first consumer starts once the routes,
+        // registered through management commands at 0s, are in place
+        addApps({
+          {"A1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "0.05s", "1s"},
+          {"A1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "1s", "1.95s"},
+          {"A4", "ns3::ndn::Producer", {{"Prefix", "/prefix"}, {"PayloadSize", "100"}}, "0s", "10s"},
+        });
+
+        Simulator::Stop(Seconds(3));
+        Simulator::Run();
+    }
+
+    size_t
+    getNCached(const std::string& node)
+    {
+        const auto& cs = getNode(node)->GetObject<L3Protocol>()->getForwarder()->getCs();
+        return std::count_if(cs.begin(), cs.end(),
+                             [](const nfd::cs::Entry& entry) { return Name("/prefix").isPrefixOf(entry.getName()); });
+    }
+};
+
+BOOST_FIXTURE_TEST_CASE(LeaveCopyEverywhere, CacheDecisionFixture)
+{
+    run("lce");
+
+    BOOST_CHECK_EQUAL(getNCached("A1"), 10);
+    BOOST_CHECK_EQUAL(getNCached("A2"), 10);
+    BOOST_CHECK_EQUAL(getNCached("A3"), 10);
+    BOOST_CHECK_EQUAL(getNCached("A4"), 10);
+}
+
+BOOST_FIXTURE_TEST_CASE(LeaveCopyDown, CacheDecisionFixture)
+{
+    run("lcd");
+
+    // Data from the producer application is first cached on the producer node; each CS hit there
+    // moves a copy one hop further down, i.e., to A3
+    BOOST_CHECK_EQUAL(getNCached("A1"), 0);
+    BOOST_CHECK_EQUAL(getNCached("A2"), 0);
+    BOOST_CHECK_EQUAL(getNCached("A3"), 10);
+    BOOST_CHECK_EQUAL(getNCached("A4"), 10);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -159,6 +159,53 @@ BOOST_AUTO_TEST_CASE(PrintLpPacket)
     }
 }
 
+BOOST_AUTO_TEST_CASE(DecodeFromPacket)
+{
+    Interest interest("/prefix");
+    interest.setNonce(10);
+    interest.setCanBePrefix(true);
+    Block wire = lp::Packet(interest.wireEncode()).wireEncode();
+
+    Ptr<Packet> packet = Create<Packet>();
+    packet->AddHeader(BlockHeader(wire));
+
+    Block decoded = BlockHeader::fromPacket(*packet);
+    BOOST_CHECK_EQUAL_COLLECTIONS(decoded.begin(), decoded.end(), wire.begin(), wire.end());
+    BOOST_CHECK_EQUAL(packet->GetSize(), wire.size()); // packet is not modified
+
+    BlockHeader header;
+    packet->RemoveHeader(header);
+    BOOST_CHECK_EQUAL_COLLECTIONS(header.getBlock().begin(), header.getBlock().end(), wire.begin(), wire.end());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeFromPaddedPacket)
+{
+    Block wire = "0501 00"_block; // shorter than e.g. the minimum Ethernet payload
+
+    Ptr<Packet> packet = Create<Packet>(46 - wire.size());
+    packet->AddHeader(BlockHeader(wire));
+
+    Block decoded = BlockHeader::fromPacket(*packet);
+    BOOST_CHECK_EQUAL_COLLECTIONS(decoded.begin(), decoded.end(), wire.begin(), wire.end());
+
+    BlockHeader header;
+    BOOST_CHECK_EQUAL(packet->RemoveHeader(header), wire.size());
+    BOOST_CHECK_EQUAL(packet->GetSize(), 46 - wire.size());
+}
+
+BOOST_AUTO_TEST_CASE(DecodeFromTruncatedPacket)
+{
+    const uint8_t truncated[] = {0x05, 0x10, 0x07, 0x00};
+    Ptr<Packet> packet = Create<Packet>(truncated, sizeof(truncated));
+    BOOST_CHECK_THROW(BlockHeader::fromPacket(*packet), ::ndn::tlv::Error);
+
+    BlockHeader header;
+    BOOST_CHECK_THROW(packet->PeekHeader(header), ::ndn::tlv::Error);
+
+    Ptr<Packet> empty = Create<Packet>();
+    BOOST_CHECK_THROW(BlockHeader::fromPacket(*empty), ::ndn::tlv::Error);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 } // namespace ndn
@@ -19,9 +19,17 @@
 
 #include "helper/ndn-scenario-helper.hpp"
 #include "helper/ndn-app-helper.hpp"
+#include "helper/ndn-strategy-choice-helper.hpp"
+#include "model/ndn-app-delivery-queue.hpp"
+#include "model/ndn-net-device-transport.hpp"
+
+#include "ns3/ndnSIM/NFD/daemon/fw/forwarder.hpp"
+#include "ns3/ndnSIM/NFD/daemon/fw/strategy.hpp"
 
 #include <ndn-cxx/face.hpp>
 
+#include "ns3/error-model.h"
+
 #include "../tests-common.hpp"
 
 namespace ns3 {
@@ -118,6 +126,160 @@ BOOST_AUTO_TEST_CASE(DisabledForwarderStatusManager)
 
 BOOST_AUTO_TEST_SUITE_END() // ManagerCheck
 
+BOOST_AUTO_TEST_CASE(DirectAppDelivery)
+{
+    getStackHelper().SetStackAttributes("DirectAppDelivery", "true");
+
+    createTopology({
+      {"1", "2"},
+      {"2", "3"},
+    });
+
+    addRoutes({
+      {"1", "2", "/prefix", 1},
+      {"2", "3", "/prefix", 1},
+    });
+
+    // consumers start once the routes and prefix registrations, made through management commands
+    // at 0s, are in place
+    addApps({
+      {"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "0.05s", "1s"},
+      {"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/local"}, {"Frequency", "10"}}, "0.05s", "1s"},
+      {"1", "ns3::ndn::Producer", {{"Prefix", "/local"}}, "0s", "2s"},
+      {"3", "ns3::ndn::Producer", {{"Prefix", "/prefix"}}, "0s", "2s"},
+    });
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+
+    Ptr<L3Protocol> node1 = getNode("1")->GetObject<L3Protocol>();
+    Ptr<L3Protocol> node3 = getNode("3")->GetObject<L3Protocol>();
+    BOOST_REQUIRE(node1->getAppDeliveryQueue() != nullptr);
+    BOOST_REQUIRE(node3->getAppDeliveryQueue() != nullptr);
+
+    const auto& counters = node1->getForwarder()->getCounters();
+    BOOST_CHECK_GT(counters.nInInterests, 10);
+    // the RIB service keeps its face status notification Interest pending, all other Interests
+    // are satisfied
+    const auto& pit = node1->getForwarder()->getPit();
+    size_t nPendingNotifications = std::count_if(pit.begin(), pit.end(), [](const nfd::pit::Entry& entry) {
+        return Name("/localhost/nfd/faces/events").isPrefixOf(entry.getName());
+    });
+    BOOST_CHECK_EQUAL(nPendingNotifications, 1);
+    BOOST_CHECK_EQUAL(counters.nSatisfiedInterests, counters.nInInterests - nPendingNotifications);
+    BOOST_CHECK_EQUAL(counters.nUnsatisfiedInterests, 0);
+
+    // Interests from the local consumer reach the local producer outside of a received packet
+    BOOST_CHECK_GT(node1->getAppDeliveryQueue()->getNScheduledDrains(), 0);
+    // everything arriving over the link is delivered without extra events
+    BOOST_CHECK_EQUAL(node3->getAppDeliveryQueue()->getNScheduledDrains(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(SingleCopyPointToPoint)
+{
+    getStackHelper().SetStackAttributes("SingleCopyPointToPoint", "true");
+
+    createTopology({
+      {"1", "2"},
+      {"2", "3"},
+    });
+
+    addRoutes({
+      {"1", "2", "/prefix", 1},
+      {"2", "3", "/prefix", 1},
+    });
+
+    addApps({
+      {"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "0s", "1s"},
+      {"3", "ns3::ndn::Producer", {{"Prefix", "/prefix"}}, "0s", "2s"},
+    });
+
+    // packets lost on the link must not confuse the receiver
+    Ptr<RateErrorModel> errorModel = CreateObject<RateErrorModel>();
+    errorModel->SetAttribute("ErrorRate", DoubleValue(0.3));
+    errorModel->SetAttribute("ErrorUnit", StringValue("ERROR_UNIT_PACKET"));
+    getNode("3")->GetDevice(0)->SetAttribute("ReceiveErrorModel", PointerValue(errorModel));
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+
+    auto getTransport = [](shared_ptr<Face> face) { return dynamic_cast<NetDeviceTransport*>(face->getTransport()); };
+
+    // the forwarder counters also include management commands, so look at the link faces only
+    const auto& counters1 = getFace("1", "2")->getCounters();
+    const auto& counters3 = getFace("3", "2")->getCounters();
+    BOOST_CHECK_GT(counters1.nInData, 0);
+    BOOST_CHECK_GT(counters3.nInInterests, 0);
+
+    // every packet received over the links is taken from the sender, none is decoded again
+    BOOST_CHECK_EQUAL(getTransport(getFace("1", "2"))->getNReceivedSharedBlocks(), counters1.nInData);
+    BOOST_CHECK_EQUAL(getTransport(getFace("3", "2"))->getNReceivedSharedBlocks(), counters3.nInInterests);
+}
+
+BOOST_AUTO_TEST_CASE(DataPlaneOnly)
+{
+    getStackHelper().setDataPlaneOnly();
+    getStackHelper().setCsSize(42);
+
+    createTopology({
+      {"1", "2"},
+    });
+
+    addRoutes({
+      {"1", "2", "/prefix", 1},
+    });
+
+    addApps({
+      {"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "0s", "1s"},
+      {"2", "ns3::ndn::Producer", {{"Prefix", "/prefix"}}, "0s", "2s"},
+    });
+
+    StrategyChoiceHelper::Install(getNode("2"), "/prefix", "/localhost/nfd/strategy/multicast");
+
+    Ptr<L3Protocol> node1 = getNode("1")->GetObject<L3Protocol>();
+    Ptr<L3Protocol> node2 = getNode("2")->GetObject<L3Protocol>();
+    BOOST_CHECK(node1->isDataPlaneOnly());
+    BOOST_CHECK(node1->getFibManager() == nullptr);
+    BOOST_CHECK_EQUAL(node1->getForwarder()->getCs().getLimit(), 42);
+
+    Simulator::Stop(Seconds(2.0));
+    Simulator::Run();
+
+    // one face for the link and one for the application, no internal faces
+    BOOST_CHECK_EQUAL(node1->getFaceTable().size(), 2);
+
+    auto& strategyChoice1 = node1->getForwarder()->getStrategyChoice();
+    auto& strategyChoice2 = node2->getForwarder()->getStrategyChoice();
+    BOOST_CHECK(Name("/localhost/nfd/strategy/multicast")
+                  .isPrefixOf(strategyChoice2.findEffectiveStrategy("/prefix").getInstanceName()));
+    BOOST_CHECK(Name("/localhost/nfd/strategy/best-route")
+                  .isPrefixOf(strategyChoice1.findEffectiveStrategy("/prefix").getInstanceName()));
+
+    const auto& counters = node1->getForwarder()->getCounters();
+    BOOST_CHECK_GT(counters.nSatisfiedInterests, 5);
+    BOOST_CHECK_EQUAL(counters.nSatisfiedInterests, counters.nInInterests);
+}
+
+BOOST_AUTO_TEST_CASE(SharedConfig)
+{
+    getStackHelper().setCsSize(7);
+
+    createTopology({
+      {"1", "2"},
+    });
+
+    Ptr<L3Protocol> node1 = getNode("1")->GetObject<L3Protocol>();
+    Ptr<L3Protocol> node2 = getNode("2")->GetObject<L3Protocol>();
+    BOOST_CHECK_EQUAL(node1->getForwarder()->getCs().getLimit(), 7);
+    BOOST_CHECK_EQUAL(node2->getForwarder()->getCs().getLimit(), 7);
+
+    // modifying the config of one node does not affect the others
+    node1->getConfig().put("tables.cs_max_packets", 1);
+    BOOST_CHECK_EQUAL(node1->getConfig().get<size_t>("tables.cs_max_packets"), 1);
+    BOOST_CHECK_EQUAL(node2->getConfig().get<size_t>("tables.cs_max_packets"), 7);
+    BOOST_CHECK_NE(&node1->getConfig(), &node2->getConfig());
+}
+
 BOOST_AUTO_TEST_SUITE_END() // ModelNdnL3Protocol
 
 } // namespace ndn
@@ -0,0 +1,142 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/util/scheduler.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+using namespace ::ndn::time_literals;
+
+class SchedulerFixture : public CleanupFixture {
+  public:
+    void
+    record(int value)
+    {
+        order.push_back(value);
+    }
+
+  public:
+    ::ndn::DummyIoService io;
+    ::ndn::Scheduler scheduler{io};
+    std::vector<int> order;
+};
+
+BOOST_FIXTURE_TEST_SUITE(NdnCxxScheduler, SchedulerFixture)
+
+BOOST_AUTO_TEST_CASE(Order)
+{
+    scheduler.schedule(30_ms, [this] { order.push_back(3); });
+    scheduler.schedule(10_ms, [this] { order.push_back(1); });
+    scheduler.schedule(20_ms, [this] { order.push_back(20); });
+    scheduler.schedule(20_ms, [this] { order.push_back(21); });
+    scheduler.schedule(20_ms, [this] {
+        order.push_back(22);
+        scheduler.schedule(0_ms, [this] { order.push_back(23); });
+    });
+
+    Simulator::Run();
+
+    std::vector<int> expected{1, 20, 21, 22, 23, 3};
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+    BOOST_CHECK_EQUAL(Simulator::Now().GetMilliSeconds(), 30);
+}
+
+BOOST_AUTO_TEST_CASE(Cancel)
+{
+    ::ndn::scheduler::EventId first = scheduler.schedule(10_ms, [this] { order.push_back(1); });
+    ::ndn::scheduler::EventId second = scheduler.schedule(20_ms, [this] { order.push_back(2); });
+    ::ndn::scheduler::EventId third = scheduler.schedule(30_ms, [this] { order.push_back(3); });
+    scheduler.schedule(40_ms, [this] { order.push_back(4); });
+    BOOST_CHECK(first && second && third);
+
+    // cancel the earliest and a middle event
+    first.cancel();
+    third.cancel();
+    BOOST_CHECK(!first);
+    BOOST_CHECK(!third);
+    BOOST_CHECK(second);
+
+    // an event earlier than all others re-arms the timer
+    scheduler.schedule(5_ms, [this] { order.push_back(0); });
+
+    Simulator::Run();
+
+    std::vector<int> expected{0, 2, 4};
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+    BOOST_CHECK(!second);
+
+    // canceling an executed event has no effect
+    second.cancel();
+}
+
+BOOST_AUTO_TEST_CASE(CancelRearmsTimer)
+{
+    scheduler.schedule(10_ms, [this] { order.push_back(1); });
+    ::ndn::scheduler::EventId later = scheduler.schedule(20_ms, [this] { order.push_back(2); });
+    Simulator::Schedule(MilliSeconds(10), &SchedulerFixture::record, this, 10);
+
+    // canceling any event re-arms the ns-3 timer, even when the first event to expire is unchanged,
+    // so the timer now runs after the ns-3 event that was scheduled for the same time
+    later.cancel();
+
+    Simulator::Run();
+
+    std::vector<int> expected{10, 1};
+    BOOST_CHECK_EQUAL_COLLECTIONS(order.begin(), order.end(), expected.begin(), expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(CancelAll)
+{
+    scheduler.schedule(10_ms, [this] { order.push_back(1); });
+    ::ndn::scheduler::EventId last = scheduler.schedule(20_ms, [this] { order.push_back(2); });
+
+    last.cancel();
+    scheduler.schedule(5_ms, [this] { scheduler.cancelAllEvents(); });
+
+    Simulator::Run();
+
+    BOOST_CHECK(order.empty());
+    BOOST_CHECK_EQUAL(Simulator::Now().GetMilliSeconds(), 5);
+}
+
+BOOST_AUTO_TEST_CASE(Many)
+{
+    std::vector<::ndn::scheduler::EventId> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids.push_back(scheduler.schedule(::ndn::time::milliseconds((i * 7919) % 1000), [this, i] {
+            order.push_back((i * 7919) % 1000);
+        }));
+    }
+    for (int i = 0; i < 1000; i += 3) {
+        ids[i].cancel();
+    }
+
+    Simulator::Run();
+
+    BOOST_CHECK_EQUAL(order.size(), 666);
+    BOOST_CHECK(std::is_sorted(order.begin(), order.end()));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
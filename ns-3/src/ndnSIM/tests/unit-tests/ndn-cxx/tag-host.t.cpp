@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include <ndn-cxx/detail/tag-host.hpp>
+#include <ndn-cxx/lp/tags.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(NdnCxxTagHost)
+
+template<int N>
+using TestTag = ::ndn::SimpleTag<int, 0x70000000 + N>;
+
+BOOST_AUTO_TEST_CASE(SetGetRemove)
+{
+    ::ndn::TagHost host;
+    BOOST_CHECK(host.getTag<TestTag<0>>() == nullptr);
+
+    // more tags than fit inline
+    host.setTag(make_shared<TestTag<0>>(0));
+    host.setTag(::ndn::makeTag<TestTag<1>>(1));
+    host.setTag(make_shared<TestTag<2>>(2));
+    host.setTag(::ndn::makeTag<TestTag<3>>(3));
+    host.setTag(make_shared<TestTag<4>>(4));
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<0>>()->get(), 0);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<1>>()->get(), 1);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<2>>()->get(), 2);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<3>>()->get(), 3);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<4>>()->get(), 4);
+
+    // replace
+    host.setTag(make_shared<TestTag<3>>(30));
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<3>>()->get(), 30);
+
+    // remove an inline tag and a spilled tag, then reuse the freed inline item
+    host.removeTag<TestTag<1>>();
+    host.removeTag<TestTag<3>>();
+    host.removeTag<TestTag<5>>();
+    BOOST_CHECK(host.getTag<TestTag<1>>() == nullptr);
+    BOOST_CHECK(host.getTag<TestTag<3>>() == nullptr);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<4>>()->get(), 4);
+
+    host.setTag(make_shared<TestTag<5>>(5));
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<5>>()->get(), 5);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<0>>()->get(), 0);
+    BOOST_CHECK_EQUAL(host.getTag<TestTag<2>>()->get(), 2);
+
+    // copies share the tag objects
+    ::ndn::TagHost copy(host);
+    BOOST_CHECK_EQUAL(copy.getTag<TestTag<4>>(), host.getTag<TestTag<4>>());
+    copy.removeTag<TestTag<4>>();
+    BOOST_CHECK(copy.getTag<TestTag<4>>() == nullptr);
+    BOOST_CHECK(host.getTag<TestTag<4>>() != nullptr);
+}
+
+BOOST_AUTO_TEST_CASE(PacketTags)
+{
+    Interest interest("/A");
+    interest.setTag(::ndn::makeTag<::ndn::lp::IncomingFaceIdTag>(7));
+    interest.setTag(::ndn::makeTag<::ndn::lp::HopCountTag>(2));
+    BOOST_CHECK_EQUAL(*interest.getTag<::ndn::lp::IncomingFaceIdTag>(), 7);
+    BOOST_CHECK_EQUAL(*interest.getTag<::ndn::lp::HopCountTag>(), 2);
+
+    interest.removeTag<::ndn::lp::HopCountTag>();
+    BOOST_CHECK(interest.getTag<::ndn::lp::HopCountTag>() == nullptr);
+    BOOST_CHECK_EQUAL(*interest.getTag<::ndn::lp::IncomingFaceIdTag>(), 7);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -22,6 +22,8 @@
 
 #include "ns3/core-module.h"
 #include "model/ndn-global-router.hpp"
+#include "ns3/ndnSIM/NFD/daemon/common/global.hpp"
+#include "ns3/ndnSIM/utils/ndn-time.hpp"
 #include "helper/ndn-scenario-helper.hpp"
 
 #include "boost-test.hpp"
@@ -31,8 +33,16 @@ namespace ndn {
 
 class CleanupFixture {
   public:
+    CleanupFixture()
+    {
+        // 不经过 StackHelper 直接创建 NFD 表的测试也要使用模拟时间
+        ::ndn::time::setCustomClocks(make_shared<time::CustomSteadyClock>(), make_shared<time::CustomSystemClock>());
+    }
+
     ~CleanupFixture()
     {
+        // 丢弃未运行的 NFD 定时器, 例如测试中直接创建的 Forwarder 留下的 PIT 定时器
+        nfd::resetGlobalScheduler();
         Simulator::Destroy();
         Names::Clear();
         GlobalRouter::clear();
@@ -0,0 +1,82 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ns3/ndnSIM/utils/ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/zero-buffer.hpp>
+
+#include "../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+BOOST_AUTO_TEST_SUITE(UtilsNdnDataTemplate)
+
+static shared_ptr<Data>
+makePrototype(size_t payloadSize, const Name& keyLocator)
+{
+    auto data = make_shared<Data>();
+    data->setFreshnessPeriod(::ndn::time::milliseconds(2000));
+    data->setContent(::ndn::getZeroBuffer(payloadSize));
+
+    SignatureInfo signatureInfo(static_cast<::ndn::tlv::SignatureTypeValue>(255));
+    if (!keyLocator.empty()) {
+        signatureInfo.setKeyLocator(keyLocator);
+    }
+    data->setSignature(Signature(signatureInfo, ::ndn::makeNonNegativeIntegerBlock(::ndn::tlv::SignatureValue, 7)));
+    return data;
+}
+
+BOOST_AUTO_TEST_CASE(SameWireAsEncode)
+{
+    for (size_t payloadSize : {0, 10, 1024, 8000}) {
+        auto prototype = makePrototype(payloadSize, "/key/locator");
+        DataTemplate dataTemplate(*prototype);
+
+        for (const Name& name : {Name("/"), Name("/prefix/A").appendSequenceNumber(payloadSize),
+                                 Name("/prefix").append(std::string(300, 'x'))}) {
+            Data expected(*prototype);
+            expected.setName(name);
+
+            auto data = dataTemplate.makeData(name);
+            BOOST_CHECK_EQUAL(data->getName(), name);
+            BOOST_CHECK_EQUAL(data->getContent().value_size(), payloadSize);
+            BOOST_CHECK_EQUAL(data->getFreshnessPeriod(), ::ndn::time::milliseconds(2000));
+            BOOST_CHECK(data->wireEncode() == expected.wireEncode());
+            BOOST_CHECK_EQUAL(data->getFullName(), expected.getFullName());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(IndependentPackets)
+{
+    DataTemplate dataTemplate(*makePrototype(100, Name()));
+    auto a = dataTemplate.makeData("/A");
+    auto b = dataTemplate.makeData("/B");
+
+    BOOST_CHECK_EQUAL(a->getName(), "/A");
+    BOOST_CHECK_EQUAL(b->getName(), "/B");
+    BOOST_CHECK(a->wireEncode().wire() != b->wireEncode().wire());
+    BOOST_CHECK(!a->getSignature().hasKeyLocator());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,107 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-async-trace-stream.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.txt";
+const boost::filesystem::path TEST_ASYNC_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace-async.txt";
+
+class AsyncTraceStreamFixture : public ScenarioHelperWithCleanupFixture {
+  public:
+    AsyncTraceStreamFixture()
+    {
+        boost::filesystem::create_directories(TEST_CONFIG_PATH);
+    }
+
+    ~AsyncTraceStreamFixture()
+    {
+        GlobalValue::Bind("NdnAsyncTraceWriter", BooleanValue(false));
+        boost::filesystem::remove(TEST_TRACE);
+        boost::filesystem::remove(TEST_ASYNC_TRACE);
+        L3RateTracer::Destroy(); // additional cleanup
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnAsyncTraceStream, AsyncTraceStreamFixture)
+
+BOOST_AUTO_TEST_CASE(WriteAndFlush)
+{
+    auto output = make_shared<std::stringstream>();
+    std::ostringstream expected;
+    {
+        AsyncTraceStream os(output, 16, 2); // tiny chunks, so that the ring is full most of the time
+        for (int i = 0; i < 10000; ++i) {
+            os << i << "\t" << i * 0.5 << "\n";
+            expected << i << "\t" << i * 0.5 << "\n";
+            if (i == 100) {
+                os.flush();
+                BOOST_CHECK_EQUAL(output->str(), expected.str());
+            }
+        }
+    }
+    BOOST_CHECK_EQUAL(output->str(), expected.str());
+}
+
+BOOST_AUTO_TEST_CASE(L3RateTracerSameAsSync)
+{
+    Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+    Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+    Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("20p"));
+
+    createTopology({{"1", "2"}});
+    addRoutes({{"1", "2", "/prefix", 1}});
+    addApps({{"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "0s", "1s"},
+             {"2", "ns3::ndn::Producer", {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}}, "0s", "100s"}});
+
+    GlobalValue::Bind("NdnAsyncTraceWriter", BooleanValue(true));
+    L3RateTracer::InstallAll(TEST_ASYNC_TRACE.string(), Seconds(0.1));
+    GlobalValue::Bind("NdnAsyncTraceWriter", BooleanValue(false));
+    L3RateTracer::InstallAll(TEST_TRACE.string(), Seconds(0.1));
+
+    Simulator::Stop(Seconds(2));
+    Simulator::Run();
+
+    L3RateTracer::Destroy(); // to force log to be written
+
+    std::ifstream sync(TEST_TRACE.string());
+    std::stringstream expected;
+    expected << sync.rdbuf();
+    std::ifstream async(TEST_ASYNC_TRACE.string());
+    std::stringstream actual;
+    actual << async.rdbuf();
+
+    BOOST_CHECK_GT(expected.str().size(), 0);
+    BOOST_CHECK_EQUAL(actual.str(), expected.str());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
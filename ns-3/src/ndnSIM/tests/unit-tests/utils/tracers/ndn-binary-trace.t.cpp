@@ -0,0 +1,229 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "utils/tracers/ndn-binary-trace.hpp"
+#include "utils/tracers/ndn-app-delay-tracer.hpp"
+#include "utils/tracers/ndn-l3-rate-tracer.hpp"
+
+#include <boost/filesystem.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+
+#include <fstream>
+#include <sstream>
+
+#include "../../tests-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+const boost::filesystem::path TEST_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.txt";
+const boost::filesystem::path TEST_BINARY_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.bin";
+const boost::filesystem::path TEST_GZIP_TRACE = boost::filesystem::path(TEST_CONFIG_PATH) / "trace.bin.gz";
+
+class BinaryTraceFixture : public ScenarioHelperWithCleanupFixture {
+  public:
+    BinaryTraceFixture()
+    {
+        boost::filesystem::create_directories(TEST_CONFIG_PATH);
+
+        // setting default parameters for PointToPoint links and channels
+        Config::SetDefault("ns3::PointToPointNetDevice::DataRate", StringValue("10Mbps"));
+        Config::SetDefault("ns3::PointToPointChannel::Delay", StringValue("10ms"));
+        Config::SetDefault("ns3::QueueBase::MaxSize", StringValue("20p"));
+
+        createTopology({{"1", "2"}, {"2", "3"}});
+
+        addRoutes({{"1", "2", "/prefix", 1}, {"2", "3", "/prefix", 1}});
+
+        addApps({{"1", "ns3::ndn::ConsumerCbr", {{"Prefix", "/prefix"}, {"Frequency", "10"}}, "1s", "2s"},
+                 {"3", "ns3::ndn::Producer", {{"Prefix", "/prefix"}, {"PayloadSize", "1024"}}, "0s", "100s"}});
+    }
+
+    ~BinaryTraceFixture()
+    {
+        boost::filesystem::remove(TEST_TRACE);
+        boost::filesystem::remove(TEST_BINARY_TRACE);
+        boost::filesystem::remove(TEST_GZIP_TRACE);
+        L3RateTracer::Destroy(); // additional cleanup
+        AppDelayTracer::Destroy();
+    }
+
+    static std::string
+    readText(const boost::filesystem::path& path)
+    {
+        std::ifstream is(path.string());
+        std::stringstream buffer;
+        buffer << is.rdbuf();
+        return buffer.str();
+    }
+
+    static std::string
+    convert(const boost::filesystem::path& path)
+    {
+        namespace io = boost::iostreams;
+        std::ifstream file(path.string(), std::ios_base::in | std::ios_base::binary);
+        io::filtering_istream is;
+        if (path.extension() == ".gz") {
+            is.push(io::gzip_decompressor());
+        }
+        is.push(file);
+
+        std::ostringstream os;
+        BinaryTraceReader(is).writeTsv(os);
+        return os.str();
+    }
+};
+
+BOOST_FIXTURE_TEST_SUITE(UtilsTracersNdnBinaryTrace, BinaryTraceFixture)
+
+BOOST_AUTO_TEST_CASE(RoundTrip)
+{
+    auto stream = make_shared<std::stringstream>();
+    {
+        BinaryTraceWriter writer(stream,
+                                 {{"Time", TraceColumn::DOUBLE}, {"Node", TraceColumn::STRING},
+                                  {"Count", TraceColumn::INT64}},
+                                 2); // several blocks, strings spread across them
+        writer.addDouble(0.5).addString("a").addInt(-1);
+        writer.endRecord();
+        writer.addDouble(1).addString("b").addInt(2);
+        writer.endRecord();
+        writer.addDouble(1.5).addString("a").addInt(3);
+        writer.endRecord();
+        writer.addDouble(2).addString("c").addInt(4);
+        writer.endRecord();
+        writer.addDouble(2.5).addString("b").addInt(5);
+        writer.endRecord();
+    }
+
+    BinaryTraceReader reader(*stream);
+    BOOST_REQUIRE_EQUAL(reader.getSchema().size(), 3);
+    BOOST_CHECK_EQUAL(reader.getSchema()[1].name, "Node");
+    BOOST_CHECK_EQUAL(reader.getSchema()[1].type, TraceColumn::STRING);
+
+    std::vector<BinaryTraceReader::Value> record;
+    BOOST_REQUIRE(reader.readRecord(record));
+    BOOST_CHECK_EQUAL(record[0].d, 0.5);
+    BOOST_CHECK_EQUAL(*record[1].s, "a");
+    BOOST_CHECK_EQUAL(record[2].i, -1);
+
+    std::ostringstream os;
+    reader.writeTsv(os);
+    BOOST_CHECK_EQUAL(os.str(), "Time\tNode\tCount\n"
+                                "1\tb\t2\n"
+                                "1.5\ta\t3\n"
+                                "2\tc\t4\n"
+                                "2.5\tb\t5\n");
+    BOOST_CHECK(!reader.readRecord(record));
+}
+
+BOOST_AUTO_TEST_CASE(OtherByteOrder)
+{
+    // 由另一种字节序的机器写出的 trace: 每个数值的字节都反过来, 字符串不变
+    std::string bytes;
+    auto addSwapped = [&bytes](const void* value, size_t size) {
+        std::string valueBytes(static_cast<const char*>(value), size);
+        bytes.append(valueBytes.rbegin(), valueBytes.rend());
+    };
+    auto addUint32 = [&](uint32_t value) { addSwapped(&value, sizeof(value)); };
+    auto addString = [&](const std::string& str) {
+        addUint32(str.size());
+        bytes += str;
+    };
+
+    bytes += "NDNTRACE";
+    addUint32(1);          // version
+    addUint32(0x01020304); // byte order marker
+    addUint32(3);
+    for (const auto& column : TraceSchema{{"Time", TraceColumn::DOUBLE},
+                                          {"Node", TraceColumn::STRING},
+                                          {"Packets", TraceColumn::INT64}}) {
+        bytes += static_cast<char>(column.type);
+        addString(column.name);
+    }
+
+    addUint32(2); // records in the block
+    addUint32(1); // new strings in the block
+    addString("leaf");
+    for (double value : {0.5, 1.0}) {
+        addSwapped(&value, sizeof(value));
+    }
+    for (uint32_t index : {0, 0}) {
+        addSwapped(&index, sizeof(index));
+    }
+    for (int64_t value : {7, -2}) {
+        addSwapped(&value, sizeof(value));
+    }
+
+    std::istringstream is(bytes);
+    BinaryTraceReader reader(is);
+    BOOST_REQUIRE_EQUAL(reader.getSchema().size(), 3);
+    BOOST_CHECK_EQUAL(reader.getSchema()[0].name, "Time");
+    BOOST_CHECK_EQUAL(reader.getSchema()[1].name, "Node");
+    BOOST_CHECK_EQUAL(reader.getSchema()[2].name, "Packets");
+    BOOST_CHECK_EQUAL(reader.getSchema()[2].type, TraceColumn::INT64);
+
+    std::ostringstream os;
+    reader.writeTsv(os);
+    BOOST_CHECK_EQUAL(os.str(), "Time\tNode\tPackets\n"
+                                "0.5\tleaf\t7\n"
+                                "1\tleaf\t-2\n");
+}
+
+BOOST_AUTO_TEST_CASE(NotBinaryTrace)
+{
+    std::istringstream is("Time\tNode\n");
+    BOOST_CHECK_THROW(BinaryTraceReader reader(is), BinaryTraceReader::Error);
+}
+
+BOOST_AUTO_TEST_CASE(L3RateTracerSameAsText)
+{
+    L3RateTracer::InstallAll(TEST_TRACE.string(), Seconds(0.5));
+    L3RateTracer::InstallAll(TEST_BINARY_TRACE.string(), Seconds(0.5), TraceFormat::Binary);
+
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+
+    L3RateTracer::Destroy(); // to force log to be written
+
+    std::string text = readText(TEST_TRACE);
+    BOOST_CHECK_GT(text.size(), 0);
+    BOOST_CHECK_EQUAL(convert(TEST_BINARY_TRACE), text);
+}
+
+BOOST_AUTO_TEST_CASE(AppDelayTracerSameAsText)
+{
+    AppDelayTracer::InstallAll(TEST_TRACE.string());
+    AppDelayTracer::InstallAll(TEST_GZIP_TRACE.string(), TraceFormat::Binary);
+
+    Simulator::Stop(Seconds(3));
+    Simulator::Run();
+
+    AppDelayTracer::Destroy(); // to force log to be written
+
+    std::string text = readText(TEST_TRACE);
+    BOOST_CHECK_GT(text.size(), 0);
+    BOOST_CHECK_EQUAL(convert(TEST_GZIP_TRACE), text);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,57 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-data-template.hpp"
+
+#include <ndn-cxx/encoding/encoding-buffer.hpp>
+
+namespace ns3 {
+namespace ndn {
+
+DataTemplate::DataTemplate(const Data& prototype)
+{
+    Data data(prototype);
+    data.setName(Name());
+
+    // Data ::= DATA-TLV TLV-LENGTH Name ... ; 取 Name 之后的所有元素
+    const Block& wire = data.wireEncode();
+    wire.parse();
+    const Block& name = wire.elements().front();
+    m_tail.assign(name.end(), wire.value_end());
+}
+
+shared_ptr<Data>
+DataTemplate::makeData(const Name& name) const
+{
+    const Block& nameWire = name.wireEncode();
+    size_t valueLength = nameWire.size() + m_tail.size();
+    size_t totalLength = ::ndn::tlv::sizeOfVarNumber(::ndn::tlv::Data) +
+                         ::ndn::tlv::sizeOfVarNumber(valueLength) + valueLength;
+
+    ::ndn::EncodingBuffer encoder(totalLength, 0);
+    encoder.prependByteArray(m_tail.data(), m_tail.size());
+    encoder.prependBlock(nameWire);
+    encoder.prependVarNumber(valueLength);
+    encoder.prependVarNumber(::ndn::tlv::Data);
+
+    return make_shared<Data>(encoder.block());
+}
+
+} // namespace ndn
+} // namespace ns3
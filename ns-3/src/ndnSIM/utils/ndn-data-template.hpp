@@ -0,0 +1,68 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
+#define NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-apps
+ * @brief Pre-encoded Data packet that differs between instances only in its Name
+ *
+ * MetaInfo, Content, SignatureInfo and SignatureValue of the prototype are encoded once.
+ * makeData() writes the Data TLV header and the Name in front of this tail, so every Data
+ * costs one buffer allocation and one copy of the tail. The produced wire encoding is
+ * identical to what Data::wireEncode() gives for the prototype with the Name replaced.
+ */
+class DataTemplate {
+  public:
+    /**
+     * @brief Encode the invariant part of @p prototype
+     *
+     * The Name of @p prototype is ignored. @p prototype must be signed.
+     */
+    explicit DataTemplate(const Data& prototype);
+
+    /**
+     * @brief Create a Data packet with the given name, wire encoding included
+     */
+    shared_ptr<Data>
+    makeData(const Name& name) const;
+
+    /**
+     * @return size of the encoded elements following the Name
+     */
+    size_t
+    getTailSize() const
+    {
+        return m_tail.size();
+    }
+
+  private:
+    ::ndn::Buffer m_tail;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDNSIM_UTILS_NDN_DATA_TEMPLATE_HPP
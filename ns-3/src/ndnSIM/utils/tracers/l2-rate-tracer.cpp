@@ -44,23 +44,19 @@ L2RateTracer::Destroy()
 }
 
 void
-L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                         ndn::TraceFormat format /* = ndn::TraceFormat::Text*/)
 {
     std::list<Ptr<L2RateTracer>> tracers;
-    std::shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        std::shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
+    std::shared_ptr<std::ostream> outputStream = ndn::openTraceFile(file, format);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
-    else {
-        outputStream = std::shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+
+    std::shared_ptr<ndn::BinaryTraceWriter> writer;
+    if (format == ndn::TraceFormat::Binary) {
+        writer = std::make_shared<ndn::BinaryTraceWriter>(outputStream, GetBinarySchema());
     }
 
     for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
@@ -68,10 +64,11 @@ L2RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seco
 
         Ptr<L2RateTracer> trace = Create<L2RateTracer>(outputStream, *node);
         trace->SetAveragingPeriod(averagingPeriod);
+        trace->m_writer = writer;
         tracers.push_back(trace);
     }
 
-    if (tracers.size() > 0) {
+    if (tracers.size() > 0 && writer == nullptr) {
         // *m_l3RateTrace << "# "; // not necessary for R's read.table
         tracers.front()->PrintHeader(*outputStream);
         *outputStream << "\n";
@@ -103,7 +100,12 @@ L2RateTracer::SetAveragingPeriod(const Time& period)
 void
 L2RateTracer::PeriodicPrinter()
 {
-    Print(*m_os);
+    if (m_writer != nullptr) {
+        Print(*m_writer);
+    }
+    else {
+        Print(*m_os);
+    }
     Reset();
 
     m_printEvent = Simulator::Schedule(m_period, &L2RateTracer::PeriodicPrinter, this);
@@ -143,10 +145,13 @@ const double alpha = 0.8;
 #define STATS(INDEX) std::get<INDEX>(m_stats)
 #define RATE(INDEX, fieldName) STATS(INDEX).fieldName / m_period.ToDouble(Time::S)
 
-#define PRINTER(printName, fieldName, interface)                                                                       \
+#define UPDATE(fieldName)                                                                                              \
     STATS(2).fieldName = /*new value*/ alpha * RATE(0, fieldName) + /*old value*/ (1 - alpha) * STATS(2).fieldName;    \
     STATS(3).fieldName =                                                                                               \
-      /*new value*/ alpha * RATE(1, fieldName) / 1024.0 + /*old value*/ (1 - alpha) * STATS(3).fieldName;              \
+      /*new value*/ alpha * RATE(1, fieldName) / 1024.0 + /*old value*/ (1 - alpha) * STATS(3).fieldName;
+
+#define PRINTER(printName, fieldName, interface)                                                                       \
+    UPDATE(fieldName)                                                                                                  \
                                                                                                                        \
     os << time.ToDouble(Time::S) << "\t" << m_node << "\t" << interface << "\t" << printName << "\t"                   \
        << STATS(2).fieldName << "\t" << STATS(3).fieldName << "\t" << STATS(0).fieldName << "\t"                       \
@@ -160,6 +165,34 @@ L2RateTracer::Print(std::ostream& os) const
     PRINTER("Drop", m_drop, "combined");
 }
 
+ndn::TraceSchema
+L2RateTracer::GetBinarySchema()
+{
+    using ndn::TraceColumn;
+    return {{"Time", TraceColumn::DOUBLE},       {"Node", TraceColumn::STRING},
+            {"Interface", TraceColumn::STRING},  {"Type", TraceColumn::STRING},
+            {"Packets", TraceColumn::DOUBLE},    {"Kilobytes", TraceColumn::DOUBLE},
+            {"PacketsRaw", TraceColumn::DOUBLE}, {"KilobytesRaw", TraceColumn::DOUBLE}};
+}
+
+#define BINARY_PRINTER(printName, fieldName, interface)                                                                \
+    UPDATE(fieldName)                                                                                                  \
+                                                                                                                       \
+    writer.addDouble(time.ToDouble(Time::S)).addString(m_node).addString(interface).addString(printName)               \
+      .addDouble(STATS(2).fieldName)                                                                                   \
+      .addDouble(STATS(3).fieldName)                                                                                   \
+      .addDouble(STATS(0).fieldName)                                                                                   \
+      .addDouble(STATS(1).fieldName / 1024.0);                                                                         \
+    writer.endRecord();
+
+void
+L2RateTracer::Print(ndn::BinaryTraceWriter& writer) const
+{
+    Time time = Simulator::Now();
+
+    BINARY_PRINTER("Drop", m_drop, "combined");
+}
+
 void
 L2RateTracer::Drop(Ptr<const Packet> packet)
 {
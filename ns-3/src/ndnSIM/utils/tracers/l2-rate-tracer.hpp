@@ -21,6 +21,7 @@
 #define L2_RATE_TRACER_H
 
 #include "l2-tracer.hpp"
+#include "ndn-binary-trace.hpp"
 
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
@@ -51,13 +52,15 @@ class L2RateTracer : public L2Tracer {
      * @param averagingPeriod Defines averaging period for the rate calculation,
      *        as well as how often data will be written into the trace file (default, every half
      *second)
+     * @param format TraceFormat::Binary writes BinaryTraceWriter records instead of text
      *
      * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
      *tuple needs to be preserved
      *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
      *
      */
-    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+                           ndn::TraceFormat format = ndn::TraceFormat::Text);
 
     /**
      * @brief Explicit request to remove all statically created tracers
@@ -73,6 +76,16 @@ class L2RateTracer : public L2Tracer {
 
     virtual void Print(std::ostream& os) const;
 
+    /**
+     * @brief Columns of the records written by Print(ndn::BinaryTraceWriter&)
+     */
+    static ndn::TraceSchema GetBinarySchema();
+
+    /**
+     * @brief Write the same records as Print(std::ostream&) in binary form
+     */
+    void Print(ndn::BinaryTraceWriter& writer) const;
+
     virtual void Drop(Ptr<const Packet>);
 
   private:
@@ -82,6 +95,7 @@ class L2RateTracer : public L2Tracer {
 
   private:
     std::shared_ptr<std::ostream> m_os;
+    std::shared_ptr<ndn::BinaryTraceWriter> m_writer; ///< @brief if set, used instead of m_os
     Time m_period;
     EventId m_printEvent;
 
@@ -48,34 +48,27 @@ AppDelayTracer::Destroy()
 }
 
 void
-AppDelayTracer::InstallAll(const std::string& file)
+AppDelayTracer::InstallAll(const std::string& file, TraceFormat format /* = TraceFormat::Text*/)
 {
-    using namespace boost;
-    using namespace std;
-
     std::list<Ptr<AppDelayTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, format);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+
+    shared_ptr<BinaryTraceWriter> writer;
+    if (format == TraceFormat::Binary) {
+        writer = make_shared<BinaryTraceWriter>(outputStream, GetBinarySchema());
     }
 
     for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
         Ptr<AppDelayTracer> trace = Install(*node, outputStream);
+        trace->m_writer = writer;
         tracers.push_back(trace);
     }
 
-    if (tracers.size() > 0) {
+    if (tracers.size() > 0 && writer == nullptr) {
         // *m_l3RateTrace << "# "; // not necessary for R's read.table
         tracers.front()->PrintHeader(*outputStream);
         *outputStream << "\n";
@@ -91,20 +84,10 @@ AppDelayTracer::Install(const NodeContainer& nodes, const std::string& file)
     using namespace std;
 
     std::list<Ptr<AppDelayTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
@@ -128,20 +111,10 @@ AppDelayTracer::Install(Ptr<Node> node, const std::string& file)
     using namespace std;
 
     std::list<Ptr<AppDelayTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     Ptr<AppDelayTracer> trace = Install(node, outputStream);
@@ -227,9 +200,28 @@ AppDelayTracer::PrintHeader(std::ostream& os) const
        << "";
 }
 
+TraceSchema
+AppDelayTracer::GetBinarySchema()
+{
+    return {{"Time", TraceColumn::DOUBLE},   {"Node", TraceColumn::STRING},    {"AppId", TraceColumn::INT64},
+            {"SeqNo", TraceColumn::INT64},   {"Type", TraceColumn::STRING},    {"DelayS", TraceColumn::DOUBLE},
+            {"DelayUS", TraceColumn::DOUBLE}, {"RetxCount", TraceColumn::INT64}, {"HopCount", TraceColumn::INT64}};
+}
+
 void
 AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, int32_t hopCount)
 {
+    if (m_writer != nullptr) {
+        m_writer->addDouble(Simulator::Now().ToDouble(Time::S)).addString(m_node).addInt(app->GetId()).addInt(seqno)
+          .addString("LastDelay")
+          .addDouble(delay.ToDouble(Time::S))
+          .addDouble(delay.ToDouble(Time::US))
+          .addInt(1)
+          .addInt(hopCount);
+        m_writer->endRecord();
+        return;
+    }
+
     *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t" << seqno << "\t"
           << "LastDelay"
           << "\t" << delay.ToDouble(Time::S) << "\t" << delay.ToDouble(Time::US) << "\t" << 1 << "\t" << hopCount
@@ -239,6 +231,17 @@ AppDelayTracer::LastRetransmittedInterestDataDelay(Ptr<App> app, uint32_t seqno,
 void
 AppDelayTracer::FirstInterestDataDelay(Ptr<App> app, uint32_t seqno, Time delay, uint32_t retxCount, int32_t hopCount)
 {
+    if (m_writer != nullptr) {
+        m_writer->addDouble(Simulator::Now().ToDouble(Time::S)).addString(m_node).addInt(app->GetId()).addInt(seqno)
+          .addString("FullDelay")
+          .addDouble(delay.ToDouble(Time::S))
+          .addDouble(delay.ToDouble(Time::US))
+          .addInt(retxCount)
+          .addInt(hopCount);
+        m_writer->endRecord();
+        return;
+    }
+
     *m_os << Simulator::Now().ToDouble(Time::S) << "\t" << m_node << "\t" << app->GetId() << "\t" << seqno << "\t"
           << "FullDelay"
           << "\t" << delay.ToDouble(Time::S) << "\t" << delay.ToDouble(Time::US) << "\t" << retxCount << "\t"
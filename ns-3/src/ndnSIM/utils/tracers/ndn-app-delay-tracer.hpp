@@ -21,6 +21,7 @@
 #define CCNX_APP_DELAY_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ndn-binary-trace.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -50,9 +51,10 @@ class AppDelayTracer : public SimpleRefCount<AppDelayTracer> {
      * @brief Helper method to install tracers on all simulation nodes
      *
      * @param file File to which traces will be written.  If filename is -, then std::out is used
+     * @param format TraceFormat::Binary writes BinaryTraceWriter records instead of text
      *
      */
-    static void InstallAll(const std::string& file);
+    static void InstallAll(const std::string& file, TraceFormat format = TraceFormat::Text);
 
     /**
      * @brief Helper method to install tracers on the selected simulation nodes
@@ -121,6 +123,11 @@ class AppDelayTracer : public SimpleRefCount<AppDelayTracer> {
      */
     void PrintHeader(std::ostream& os) const;
 
+    /**
+     * @brief Columns of the records written in binary mode
+     */
+    static TraceSchema GetBinarySchema();
+
   private:
     void Connect();
 
@@ -133,6 +140,7 @@ class AppDelayTracer : public SimpleRefCount<AppDelayTracer> {
     Ptr<Node> m_nodePtr;
 
     shared_ptr<std::ostream> m_os;
+    shared_ptr<BinaryTraceWriter> m_writer; ///< @brief if set, used instead of m_os
 };
 
 } // namespace ndn
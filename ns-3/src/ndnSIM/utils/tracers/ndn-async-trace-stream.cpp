@@ -0,0 +1,204 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-async-trace-stream.hpp"
+
+namespace ns3 {
+namespace ndn {
+
+AsyncTraceStreamBuf::Ring::Ring(size_t capacity)
+  : m_slots(capacity + 1)
+{
+}
+
+bool
+AsyncTraceStreamBuf::Ring::push(Chunk* chunk)
+{
+    size_t tail = m_tail.load(std::memory_order_relaxed);
+    size_t next = (tail + 1) % m_slots.size();
+    if (next == m_head.load(std::memory_order_acquire)) {
+        return false;
+    }
+    m_slots[tail] = chunk;
+    m_tail.store(next, std::memory_order_release);
+    return true;
+}
+
+bool
+AsyncTraceStreamBuf::Ring::pop(Chunk*& chunk)
+{
+    size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    chunk = m_slots[head];
+    m_head.store((head + 1) % m_slots.size(), std::memory_order_release);
+    return true;
+}
+
+AsyncTraceStreamBuf::AsyncTraceStreamBuf(shared_ptr<std::ostream> os, size_t chunkSize, size_t nChunks)
+  : m_os(std::move(os))
+  , m_chunkSize(chunkSize)
+  , m_filled(nChunks)
+  , m_recycled(nChunks)
+{
+    BOOST_ASSERT(m_chunkSize > 0 && nChunks > 0);
+    m_current = acquireChunk();
+    setp(m_current->data.data(), m_current->data.data() + m_chunkSize);
+
+    m_writer = std::thread(&AsyncTraceStreamBuf::runWriter, this);
+}
+
+AsyncTraceStreamBuf::~AsyncTraceStreamBuf()
+{
+    close();
+}
+
+void
+AsyncTraceStreamBuf::close()
+{
+    if (!m_writer.joinable()) {
+        return;
+    }
+
+    submit(true);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_isStopping = true;
+    }
+    m_cv.notify_one();
+    m_writer.join();
+
+    delete m_current;
+    m_current = nullptr;
+    setp(nullptr, nullptr);
+
+    Chunk* chunk = nullptr;
+    while (m_recycled.pop(chunk)) {
+        delete chunk;
+    }
+}
+
+AsyncTraceStreamBuf::Chunk*
+AsyncTraceStreamBuf::acquireChunk()
+{
+    Chunk* chunk = nullptr;
+    if (!m_recycled.pop(chunk)) {
+        chunk = new Chunk;
+        chunk->data.resize(m_chunkSize);
+    }
+    return chunk;
+}
+
+void
+AsyncTraceStreamBuf::submit(bool needFlush)
+{
+    m_current->size = pptr() - pbase();
+    m_current->needFlush = needFlush;
+    if (m_current->size == 0 && !needFlush) {
+        return;
+    }
+
+    while (!m_filled.push(m_current)) {
+        // every chunk is in flight: the writer thread is behind, so wait for it
+        std::this_thread::yield();
+    }
+    ++m_nSubmitted;
+    {
+        // once per chunk, not per record; the lock orders the push before the writer's wait check
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_one();
+    }
+
+    m_current = acquireChunk();
+    setp(m_current->data.data(), m_current->data.data() + m_chunkSize);
+}
+
+AsyncTraceStreamBuf::int_type
+AsyncTraceStreamBuf::overflow(int_type ch)
+{
+    if (m_current == nullptr) {
+        return traits_type::eof(); // closed
+    }
+
+    submit(false);
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+        *pptr() = traits_type::to_char_type(ch);
+        pbump(1);
+    }
+    return traits_type::not_eof(ch);
+}
+
+int
+AsyncTraceStreamBuf::sync()
+{
+    if (m_current == nullptr) {
+        return -1;
+    }
+
+    submit(true);
+    while (m_nWritten.load(std::memory_order_acquire) != m_nSubmitted) {
+        std::this_thread::yield();
+    }
+    return m_os->good() ? 0 : -1;
+}
+
+void
+AsyncTraceStreamBuf::runWriter()
+{
+    while (true) {
+        Chunk* chunk = nullptr;
+        if (m_filled.pop(chunk)) {
+            m_os->write(chunk->data.data(), chunk->size);
+            if (chunk->needFlush) {
+                m_os->flush();
+            }
+            if (!m_recycled.push(chunk)) {
+                delete chunk;
+            }
+            m_nWritten.fetch_add(1, std::memory_order_release);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_isStopping) {
+            // the last chunk is submitted before m_isStopping is set
+            if (m_nWritten.load(std::memory_order_relaxed) == m_nSubmitted) {
+                break;
+            }
+            continue;
+        }
+        m_cv.wait(lock, [this] { return !m_filled.empty() || m_isStopping; });
+    }
+}
+
+AsyncTraceStream::AsyncTraceStream(shared_ptr<std::ostream> os, size_t chunkSize, size_t nChunks)
+  : std::ostream(nullptr)
+  , m_buf(std::move(os), chunkSize, nChunks)
+{
+    rdbuf(&m_buf);
+}
+
+AsyncTraceStream::~AsyncTraceStream()
+{
+    m_buf.close();
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,140 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_ASYNC_TRACE_STREAM_HPP
+#define NDN_ASYNC_TRACE_STREAM_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Stream buffer that hands the written bytes to a dedicated writer thread
+ *
+ * The simulation thread fills a chunk and pushes it into a lock-free single-producer
+ * single-consumer ring; the writer thread writes chunks into the underlying stream in order and
+ * returns them through a second ring for reuse. The simulation thread blocks only if all
+ * chunks are in flight, i.e., if the disk cannot keep up at all.
+ */
+class AsyncTraceStreamBuf : public std::streambuf, boost::noncopyable {
+  public:
+    /**
+     * @param os underlying stream, accessed only by the writer thread until close()
+     * @param chunkSize size of one chunk in bytes
+     * @param nChunks maximum number of chunks waiting for the writer thread
+     */
+    AsyncTraceStreamBuf(shared_ptr<std::ostream> os, size_t chunkSize, size_t nChunks);
+
+    ~AsyncTraceStreamBuf();
+
+    /**
+     * @brief Write out the remaining data, stop the writer thread and flush the underlying stream
+     */
+    void close();
+
+  protected:
+    int_type overflow(int_type ch) override;
+
+    /**
+     * @brief Wait until everything written so far reached the underlying stream, then flush it
+     */
+    int sync() override;
+
+  private:
+    struct Chunk {
+        std::vector<char> data;
+        size_t size = 0;
+        bool needFlush = false;
+    };
+
+    /**
+     * @brief Bounded lock-free queue with exactly one pushing and one popping thread
+     */
+    class Ring {
+      public:
+        explicit Ring(size_t capacity);
+
+        bool push(Chunk* chunk);
+
+        bool pop(Chunk*& chunk);
+
+        bool empty() const
+        {
+            return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+        }
+
+      private:
+        std::vector<Chunk*> m_slots;
+        std::atomic<size_t> m_head{0}; ///< next slot to pop, owned by the consumer
+        std::atomic<size_t> m_tail{0}; ///< next slot to push, owned by the producer
+    };
+
+    Chunk* acquireChunk();
+
+    void submit(bool needFlush);
+
+    void runWriter();
+
+  private:
+    shared_ptr<std::ostream> m_os;
+    size_t m_chunkSize;
+
+    Ring m_filled;   // simulation thread -> writer thread
+    Ring m_recycled; // writer thread -> simulation thread
+    Chunk* m_current = nullptr;
+
+    size_t m_nSubmitted = 0;
+    std::atomic<size_t> m_nWritten{0};
+    std::atomic<bool> m_isStopping{false};
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::thread m_writer;
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Output stream that writes into another stream from a background thread
+ *
+ * Tracers write into it exactly as into the underlying stream; flush() waits for the writer
+ * thread. Destroying the stream writes out all data and joins the thread.
+ */
+class AsyncTraceStream : public std::ostream {
+  public:
+    explicit AsyncTraceStream(shared_ptr<std::ostream> os, size_t chunkSize = 65536, size_t nChunks = 64);
+
+    ~AsyncTraceStream();
+
+  private:
+    AsyncTraceStreamBuf m_buf;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_ASYNC_TRACE_STREAM_HPP
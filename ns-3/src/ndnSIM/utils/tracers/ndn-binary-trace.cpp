@@ -0,0 +1,384 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#include "ndn-binary-trace.hpp"
+#include "ndn-async-trace-stream.hpp"
+
+#include "ns3/boolean.h"
+#include "ns3/global-value.h"
+#include "ns3/log.h"
+
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/iostreams/filter/gzip.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/device/file.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+NS_LOG_COMPONENT_DEFINE("ndn.BinaryTrace");
+
+namespace ns3 {
+namespace ndn {
+
+static const char MAGIC[8] = {'N', 'D', 'N', 'T', 'R', 'A', 'C', 'E'};
+static const uint32_t VERSION = 1;
+static const uint32_t BYTE_ORDER_MARKER = 0x01020304;
+
+static GlobalValue g_asyncTraceWriter("NdnAsyncTraceWriter",
+                                      "If true, trace files are written by a background thread "
+                                      "(see ns3::ndn::AsyncTraceStream)",
+                                      BooleanValue(false), MakeBooleanChecker());
+
+static shared_ptr<std::ostream>
+openFile(const std::string& file, TraceFormat format)
+{
+    if (format == TraceFormat::Binary && boost::algorithm::ends_with(file, ".gz")) {
+        namespace io = boost::iostreams;
+        io::file_sink sink(file, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        if (!sink.is_open()) {
+            return nullptr;
+        }
+
+        // reset() pops the compressor, which writes the gzip trailer
+        shared_ptr<io::filtering_ostream> os(new io::filtering_ostream, [](io::filtering_ostream* os) {
+            os->reset();
+            delete os;
+        });
+        os->push(io::gzip_compressor());
+        os->push(sink);
+        return os;
+    }
+
+    auto mode = std::ios_base::out | std::ios_base::trunc;
+    if (format == TraceFormat::Binary) {
+        mode |= std::ios_base::binary;
+    }
+    auto os = make_shared<std::ofstream>(file.c_str(), mode);
+    if (!os->is_open()) {
+        return nullptr;
+    }
+    return os;
+}
+
+shared_ptr<std::ostream>
+openTraceFile(const std::string& file, TraceFormat format)
+{
+    if (file == "-") {
+        return shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    }
+
+    shared_ptr<std::ostream> os = openFile(file, format);
+    if (os == nullptr) {
+        return nullptr;
+    }
+
+    BooleanValue isAsync;
+    g_asyncTraceWriter.GetValue(isAsync);
+    if (isAsync.Get()) {
+        // gzip compression, if any, also runs on the writer thread
+        return make_shared<AsyncTraceStream>(os);
+    }
+    return os;
+}
+
+template<typename T>
+static void
+writeValue(std::ostream& os, T value)
+{
+    os.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static size_t
+getValueSize(TraceColumn::Type type)
+{
+    return type == TraceColumn::STRING ? sizeof(uint32_t) : sizeof(uint64_t);
+}
+
+BinaryTraceWriter::BinaryTraceWriter(shared_ptr<std::ostream> os, TraceSchema schema, size_t blockSize)
+  : m_os(std::move(os))
+  , m_schema(std::move(schema))
+  , m_blockSize(std::max<size_t>(blockSize, 1))
+  , m_columns(m_schema.size())
+{
+    NS_ASSERT(!m_schema.empty());
+
+    for (size_t i = 0; i < m_schema.size(); ++i) {
+        m_columns[i].reserve(m_blockSize * getValueSize(m_schema[i].type));
+    }
+
+    m_os->write(MAGIC, sizeof(MAGIC));
+    writeValue<uint32_t>(*m_os, VERSION);
+    writeValue<uint32_t>(*m_os, BYTE_ORDER_MARKER);
+    writeValue<uint32_t>(*m_os, m_schema.size());
+    for (const auto& column : m_schema) {
+        writeValue<uint8_t>(*m_os, column.type);
+        writeValue<uint32_t>(*m_os, column.name.size());
+        m_os->write(column.name.data(), column.name.size());
+    }
+}
+
+BinaryTraceWriter::~BinaryTraceWriter()
+{
+    NS_ASSERT_MSG(m_column == 0, "Incomplete record in binary trace");
+    flush();
+}
+
+void
+BinaryTraceWriter::append(TraceColumn::Type type, const void* value, size_t size)
+{
+    NS_ASSERT_MSG(m_column < m_schema.size() && m_schema[m_column].type == type,
+                  "Value does not match column " << m_column << " of the trace schema");
+
+    auto& column = m_columns[m_column++];
+    const char* bytes = static_cast<const char*>(value);
+    column.insert(column.end(), bytes, bytes + size);
+}
+
+BinaryTraceWriter&
+BinaryTraceWriter::addDouble(double value)
+{
+    append(TraceColumn::DOUBLE, &value, sizeof(value));
+    return *this;
+}
+
+BinaryTraceWriter&
+BinaryTraceWriter::addInt(int64_t value)
+{
+    append(TraceColumn::INT64, &value, sizeof(value));
+    return *this;
+}
+
+BinaryTraceWriter&
+BinaryTraceWriter::addString(const std::string& value)
+{
+    auto it = m_dictionary.find(value);
+    if (it == m_dictionary.end()) {
+        it = m_dictionary.emplace(value, static_cast<uint32_t>(m_dictionary.size())).first;
+        m_newStrings.push_back(value);
+    }
+    append(TraceColumn::STRING, &it->second, sizeof(it->second));
+    return *this;
+}
+
+void
+BinaryTraceWriter::endRecord()
+{
+    NS_ASSERT_MSG(m_column == m_schema.size(), "Record has " << m_column << " values, schema has " << m_schema.size());
+    m_column = 0;
+
+    if (++m_nRecords == m_blockSize) {
+        writeBlock();
+    }
+}
+
+void
+BinaryTraceWriter::flush()
+{
+    if (m_nRecords > 0) {
+        writeBlock();
+    }
+    m_os->flush();
+}
+
+void
+BinaryTraceWriter::writeBlock()
+{
+    writeValue<uint32_t>(*m_os, m_nRecords);
+    writeValue<uint32_t>(*m_os, m_newStrings.size());
+    for (const auto& str : m_newStrings) {
+        writeValue<uint32_t>(*m_os, str.size());
+        m_os->write(str.data(), str.size());
+    }
+    for (auto& column : m_columns) {
+        m_os->write(column.data(), column.size());
+        column.clear();
+    }
+
+    m_newStrings.clear();
+    m_nRecords = 0;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+BinaryTraceReader::BinaryTraceReader(std::istream& is)
+  : m_is(is)
+{
+    char magic[sizeof(MAGIC)];
+    if (!m_is.read(magic, sizeof(magic)) || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw Error("Not a binary ndnSIM trace");
+    }
+
+    uint32_t version = 0;
+    uint32_t marker = 0;
+    read(&version, sizeof(version));
+    read(&marker, sizeof(marker));
+    if (marker != BYTE_ORDER_MARKER) {
+        m_needSwap = true;
+        std::reverse(reinterpret_cast<char*>(&version), reinterpret_cast<char*>(&version) + sizeof(version));
+    }
+    if (version != VERSION) {
+        throw Error("Unsupported binary trace version " + std::to_string(version));
+    }
+
+    uint32_t nColumns = 0;
+    read(&nColumns, sizeof(nColumns));
+    for (uint32_t i = 0; i < nColumns; ++i) {
+        uint8_t type = 0;
+        uint32_t length = 0;
+        read(&type, sizeof(type));
+        read(&length, sizeof(length));
+        if (type > TraceColumn::STRING) {
+            throw Error("Unknown column type " + std::to_string(type));
+        }
+
+        // strings are not byte-swapped, so they are not read with read()
+        std::string name(length, '\0');
+        if (length > 0 && !m_is.read(&name[0], length)) {
+            throw Error("Truncated binary trace");
+        }
+        m_schema.push_back({name, static_cast<TraceColumn::Type>(type)});
+    }
+    m_columns.resize(m_schema.size());
+}
+
+void
+BinaryTraceReader::read(void* buffer, size_t size)
+{
+    if (!m_is.read(static_cast<char*>(buffer), size)) {
+        throw Error("Truncated binary trace");
+    }
+    if (m_needSwap && size <= sizeof(uint64_t)) {
+        std::reverse(static_cast<char*>(buffer), static_cast<char*>(buffer) + size);
+    }
+}
+
+bool
+BinaryTraceReader::readBlock()
+{
+    uint32_t nRecords = 0;
+    if (!m_is.read(reinterpret_cast<char*>(&nRecords), sizeof(nRecords))) {
+        if (m_is.gcount() == 0) {
+            return false; // end of trace
+        }
+        throw Error("Truncated binary trace");
+    }
+    if (m_needSwap) {
+        std::reverse(reinterpret_cast<char*>(&nRecords), reinterpret_cast<char*>(&nRecords) + sizeof(nRecords));
+    }
+
+    uint32_t nNewStrings = 0;
+    read(&nNewStrings, sizeof(nNewStrings));
+    for (uint32_t i = 0; i < nNewStrings; ++i) {
+        uint32_t length = 0;
+        read(&length, sizeof(length));
+        std::string str(length, '\0');
+        if (length > 0 && !m_is.read(&str[0], length)) {
+            throw Error("Truncated binary trace");
+        }
+        m_strings.push_back(std::move(str));
+    }
+
+    for (size_t i = 0; i < m_schema.size(); ++i) {
+        m_columns[i].resize(nRecords * getValueSize(m_schema[i].type));
+        if (!m_is.read(m_columns[i].data(), m_columns[i].size())) {
+            throw Error("Truncated binary trace");
+        }
+    }
+
+    m_nRecords = nRecords;
+    m_record = 0;
+    return true;
+}
+
+bool
+BinaryTraceReader::readRecord(std::vector<Value>& record)
+{
+    while (m_record == m_nRecords) {
+        if (!readBlock()) {
+            return false;
+        }
+    }
+
+    record.resize(m_schema.size());
+    for (size_t i = 0; i < m_schema.size(); ++i) {
+        size_t size = getValueSize(m_schema[i].type);
+        char bytes[sizeof(uint64_t)];
+        std::memcpy(bytes, m_columns[i].data() + m_record * size, size);
+        if (m_needSwap) {
+            std::reverse(bytes, bytes + size);
+        }
+
+        Value& value = record[i];
+        switch (m_schema[i].type) {
+        case TraceColumn::DOUBLE:
+            std::memcpy(&value.d, bytes, size);
+            break;
+        case TraceColumn::INT64:
+            std::memcpy(&value.i, bytes, size);
+            break;
+        case TraceColumn::STRING: {
+            uint32_t index = 0;
+            std::memcpy(&index, bytes, size);
+            if (index >= m_strings.size()) {
+                throw Error("Unknown string index " + std::to_string(index));
+            }
+            value.s = &m_strings[index];
+            break;
+        }
+        }
+    }
+    ++m_record;
+    return true;
+}
+
+void
+BinaryTraceReader::writeTsv(std::ostream& os)
+{
+    for (size_t i = 0; i < m_schema.size(); ++i) {
+        os << (i > 0 ? "\t" : "") << m_schema[i].name;
+    }
+    os << "\n";
+
+    std::vector<Value> record;
+    while (readRecord(record)) {
+        for (size_t i = 0; i < m_schema.size(); ++i) {
+            if (i > 0) {
+                os << "\t";
+            }
+            switch (m_schema[i].type) {
+            case TraceColumn::DOUBLE:
+                os << record[i].d;
+                break;
+            case TraceColumn::INT64:
+                os << record[i].i;
+                break;
+            case TraceColumn::STRING:
+                os << *record[i].s;
+                break;
+            }
+        }
+        os << "\n";
+    }
+}
+
+} // namespace ndn
+} // namespace ns3
@@ -0,0 +1,212 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/**
+ * Copyright (c) 2011-2020  Regents of the University of California.
+ *
+ * This file is part of ndnSIM. See AUTHORS for complete list of ndnSIM authors and
+ * contributors.
+ *
+ * ndnSIM is free software: you can redistribute it and/or modify it under the terms
+ * of the GNU General Public License as published by the Free Software Foundation,
+ * either version 3 of the License, or (at your option) any later version.
+ *
+ * ndnSIM is distributed in the hope that it will be useful, but WITHOUT ANY WARRANTY;
+ * without even the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+ * PURPOSE.  See the GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License along with
+ * ndnSIM, e.g., in COPYING.md file.  If not, see <http://www.gnu.org/licenses/>.
+ **/
+
+#ifndef NDN_BINARY_TRACE_HPP
+#define NDN_BINARY_TRACE_HPP
+
+#include "ns3/ndnSIM/model/ndn-common.hpp"
+
+#include <deque>
+#include <iosfwd>
+#include <unordered_map>
+#include <vector>
+
+namespace ns3 {
+namespace ndn {
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Output format of the tracers
+ */
+enum class TraceFormat {
+    Text,  ///< tab-separated values, one line per record
+    Binary ///< BinaryTraceWriter; gzip-compressed if the file name ends with ".gz"
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Open trace file for writing
+ *
+ * If the global value NdnAsyncTraceWriter is true, the file is written through an
+ * AsyncTraceStream, i.e., from a background thread.
+ *
+ * @param file file name; if "-", std::cout is used
+ * @param format with TraceFormat::Binary and a ".gz" file name, output is gzip-compressed
+ * @return nullptr if the file cannot be opened
+ */
+shared_ptr<std::ostream>
+openTraceFile(const std::string& file, TraceFormat format);
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Column description of a binary trace
+ */
+struct TraceColumn {
+    enum Type : uint8_t {
+        DOUBLE = 0,
+        INT64 = 1,
+        STRING = 2 ///< stored as an index into a dictionary of distinct strings
+    };
+
+    std::string name;
+    Type type;
+};
+
+using TraceSchema = std::vector<TraceColumn>;
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Columnar binary trace writer
+ *
+ * File layout (host byte order, detected by the reader through a marker):
+ *
+ *     header: "NDNTRACE" version:u32 marker:u32 nColumns:u32
+ *             { type:u8 nameLength:u32 name }*nColumns
+ *     block:  nRecords:u32 nNewStrings:u32 { length:u32 bytes }*nNewStrings
+ *             { nRecords values of the column }*nColumns
+ *
+ * Values are 8 bytes for DOUBLE and INT64 columns and a 4-byte dictionary index for STRING
+ * columns. Every string is written once, in the block where it first appears, and gets the next
+ * index. Records are buffered column by column and written one block at a time, without any
+ * number formatting. BinaryTraceReader converts the file back to tab-separated text.
+ */
+class BinaryTraceWriter : boost::noncopyable {
+  public:
+    /**
+     * @param os output stream, e.g., from openTraceFile()
+     * @param schema columns of every record
+     * @param blockSize number of records buffered before a block is written
+     */
+    BinaryTraceWriter(shared_ptr<std::ostream> os, TraceSchema schema, size_t blockSize = 65536);
+
+    /**
+     * @brief Write buffered records
+     */
+    ~BinaryTraceWriter();
+
+    /**
+     * @name Append a value to the current record, in the order of the schema
+     * @{
+     */
+    BinaryTraceWriter& addDouble(double value);
+
+    BinaryTraceWriter& addInt(int64_t value);
+
+    BinaryTraceWriter& addString(const std::string& value);
+    /** @} */
+
+    /**
+     * @brief Finish the current record
+     */
+    void endRecord();
+
+    /**
+     * @brief Write buffered records and flush the stream
+     */
+    void flush();
+
+    const TraceSchema&
+    getSchema() const
+    {
+        return m_schema;
+    }
+
+  private:
+    void append(TraceColumn::Type type, const void* value, size_t size);
+
+    void writeBlock();
+
+  private:
+    shared_ptr<std::ostream> m_os;
+    TraceSchema m_schema;
+    size_t m_blockSize;
+
+    std::vector<std::vector<char>> m_columns;
+    size_t m_column = 0;
+    size_t m_nRecords = 0;
+
+    std::unordered_map<std::string, uint32_t> m_dictionary;
+    std::vector<std::string> m_newStrings;
+};
+
+/**
+ * @ingroup ndn-tracers
+ * @brief Reader of traces written by BinaryTraceWriter
+ */
+class BinaryTraceReader : boost::noncopyable {
+  public:
+    class Error : public std::runtime_error {
+      public:
+        using std::runtime_error::runtime_error;
+    };
+
+    struct Value {
+        double d = 0;
+        int64_t i = 0;
+        const std::string* s = nullptr;
+    };
+
+    /**
+     * @brief Read the header
+     * @throw Error the stream does not contain a binary trace
+     */
+    explicit BinaryTraceReader(std::istream& is);
+
+    const TraceSchema&
+    getSchema() const
+    {
+        return m_schema;
+    }
+
+    /**
+     * @brief Read the next record
+     * @param[out] record one value per column; STRING values stay valid until the reader is destroyed
+     * @return false at the end of the trace
+     * @throw Error the trace is truncated or corrupted
+     */
+    bool readRecord(std::vector<Value>& record);
+
+    /**
+     * @brief Write the remaining records as tab-separated text, preceded by the header line
+     *
+     * The records are the same as the tracer would have written in TraceFormat::Text; the header
+     * line is built from the column names.
+     */
+    void writeTsv(std::ostream& os);
+
+  private:
+    bool readBlock();
+
+    void read(void* buffer, size_t size);
+
+  private:
+    std::istream& m_is;
+    TraceSchema m_schema;
+    bool m_needSwap = false;
+
+    std::deque<std::string> m_strings; // deque keeps Value::s valid while growing
+    std::vector<std::vector<char>> m_columns;
+    size_t m_nRecords = 0;
+    size_t m_record = 0;
+};
+
+} // namespace ndn
+} // namespace ns3
+
+#endif // NDN_BINARY_TRACE_HPP
@@ -51,37 +51,31 @@ CsTracer::Destroy()
 }
 
 void
-CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+CsTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                     TraceFormat format /* = TraceFormat::Text*/)
 {
     // ndn::CsTracer::InstallAll("cs-trace.txt", Seconds(1));
-    using namespace boost;
-    using namespace std;
-
     std::list<Ptr<CsTracer>> tracers;
     // 打开文件准备写入
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, format);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+
+    shared_ptr<BinaryTraceWriter> writer;
+    if (format == TraceFormat::Binary) {
+        writer = make_shared<BinaryTraceWriter>(outputStream, GetBinarySchema());
     }
 
     // 遍历每个节点 每个节点安装CsTracer
     for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
         Ptr<CsTracer> trace = Install(*node, outputStream, averagingPeriod);
+        trace->m_writer = writer;
         tracers.push_back(trace);
     }
 
-    if (tracers.size() > 0) {
+    if (tracers.size() > 0 && writer == nullptr) {
         // *m_l3RateTrace << "# "; // not necessary for R's read.table
         tracers.front()->PrintHeader(*outputStream);
         *outputStream << "\n";
@@ -97,20 +91,10 @@ CsTracer::Install(const NodeContainer& nodes, const std::string& file, Time aver
     using namespace std;
 
     std::list<Ptr<CsTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
@@ -134,20 +118,10 @@ CsTracer::Install(Ptr<Node> node, const std::string& file, Time averagingPeriod
     using namespace std;
 
     std::list<Ptr<CsTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     Ptr<CsTracer> trace = Install(node, outputStream, averagingPeriod);
@@ -243,7 +217,12 @@ CsTracer::PeriodicPrinter()
     // m_stats.m_cacheHits = fwdCounters.nCsHits;
     // m_stats.m_cacheMisses = fwdCounters.nCsMisses;
 
-    Print(*m_os);
+    if (m_writer != nullptr) {
+        Print(*m_writer);
+    }
+    else {
+        Print(*m_os);
+    }
     Reset(); // 每一个周期单独统计
 
     // 添加下一个打印事件(即下一个周期再次回来打印, 一直循环)
@@ -283,6 +262,28 @@ CsTracer::Print(std::ostream& os) const
     PRINTER("CacheMisses", m_cacheMisses);
 }
 
+TraceSchema
+CsTracer::GetBinarySchema()
+{
+    return {{"Time", TraceColumn::DOUBLE},
+            {"Node", TraceColumn::STRING},
+            {"Type", TraceColumn::STRING},
+            {"Packets", TraceColumn::DOUBLE}};
+}
+
+#define BINARY_PRINTER(printName, fieldName)                                                                           \
+    writer.addDouble(time.ToDouble(Time::S)).addString(m_node).addString(printName).addDouble(m_stats.fieldName);      \
+    writer.endRecord();
+
+void
+CsTracer::Print(BinaryTraceWriter& writer) const
+{
+    Time time = Simulator::Now();
+
+    BINARY_PRINTER("CacheHits", m_cacheHits);
+    BINARY_PRINTER("CacheMisses", m_cacheMisses);
+}
+
 // 什么时候会调用到这个? 在哪里调用?
 // TODO: 缓存命中时, 如何触发对应的tracer?
 void
@@ -21,6 +21,7 @@
 #define CCNX_CS_TRACER_H
 
 #include "ns3/ndnSIM/model/ndn-common.hpp"
+#include "ndn-binary-trace.hpp"
 
 #include "ns3/ptr.h"
 #include "ns3/simple-ref-count.h"
@@ -67,13 +68,15 @@ class CsTracer : public SimpleRefCount<CsTracer> {
      * @param file File to which traces will be written.  If filename is -, then std::out is used
      * @param averagingPeriod How often data will be written into the trace file (default, every half
      *second)
+     * @param format TraceFormat::Binary writes BinaryTraceWriter records instead of text
      *
      * @returns a tuple of reference to output stream and list of tracers. !!! Attention !!! This
      *tuple needs to be preserved
      *          for the lifetime of simulation, otherwise SEGFAULTs are inevitable
      *
      */
-    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+                           TraceFormat format = TraceFormat::Text);
 
     /**
      * @brief Helper method to install tracers on the selected simulation nodes
@@ -161,6 +164,16 @@ class CsTracer : public SimpleRefCount<CsTracer> {
      */
     void Print(std::ostream& os) const;
 
+    /**
+     * @brief Columns of the records written by Print(BinaryTraceWriter&)
+     */
+    static TraceSchema GetBinarySchema();
+
+    /**
+     * @brief Write the same records as Print(std::ostream&) in binary form
+     */
+    void Print(BinaryTraceWriter& writer) const;
+
   private:
     void Connect();
 
@@ -180,6 +193,7 @@ class CsTracer : public SimpleRefCount<CsTracer> {
     Ptr<Node> m_nodePtr;
 
     shared_ptr<std::ostream> m_os;
+    shared_ptr<BinaryTraceWriter> m_writer; ///< @brief if set, used instead of m_os
 
     Time m_period;
     EventId m_printEvent;
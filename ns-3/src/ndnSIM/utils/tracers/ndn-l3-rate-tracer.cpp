@@ -46,31 +46,28 @@ L3RateTracer::Destroy()
 }
 
 void
-L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/)
+L3RateTracer::InstallAll(const std::string& file, Time averagingPeriod /* = Seconds (0.5)*/,
+                         TraceFormat format /* = TraceFormat::Text*/)
 {
     std::list<Ptr<L3RateTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, format);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+
+    shared_ptr<BinaryTraceWriter> writer;
+    if (format == TraceFormat::Binary) {
+        writer = make_shared<BinaryTraceWriter>(outputStream, GetBinarySchema());
     }
 
     for (NodeList::Iterator node = NodeList::Begin(); node != NodeList::End(); node++) {
         Ptr<L3RateTracer> trace = Install(*node, outputStream, averagingPeriod);
+        trace->m_writer = writer;
         tracers.push_back(trace);
     }
 
-    if (tracers.size() > 0) {
+    if (tracers.size() > 0 && writer == nullptr) {
         // *m_l3RateTrace << "# "; // not necessary for R's read.table
         tracers.front()->PrintHeader(*outputStream);
         *outputStream << "\n";
@@ -86,20 +83,10 @@ L3RateTracer::Install(const NodeContainer& nodes, const std::string& file, Time
     using namespace std;
 
     std::list<Ptr<L3RateTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     for (NodeContainer::Iterator node = nodes.Begin(); node != nodes.End(); node++) {
@@ -123,20 +110,10 @@ L3RateTracer::Install(Ptr<Node> node, const std::string& file, Time averagingPer
     using namespace std;
 
     std::list<Ptr<L3RateTracer>> tracers;
-    shared_ptr<std::ostream> outputStream;
-    if (file != "-") {
-        shared_ptr<std::ofstream> os(new std::ofstream());
-        os->open(file.c_str(), std::ios_base::out | std::ios_base::trunc);
-
-        if (!os->is_open()) {
-            NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
-            return;
-        }
-
-        outputStream = os;
-    }
-    else {
-        outputStream = shared_ptr<std::ostream>(&std::cout, std::bind([] {}));
+    shared_ptr<std::ostream> outputStream = openTraceFile(file, TraceFormat::Text);
+    if (outputStream == nullptr) {
+        NS_LOG_ERROR("File " << file << " cannot be opened for writing. Tracing disabled");
+        return;
     }
 
     Ptr<L3RateTracer> trace = Install(node, outputStream, averagingPeriod);
@@ -192,7 +169,13 @@ L3RateTracer::SetAveragingPeriod(const Time& period)
 void
 L3RateTracer::PeriodicPrinter()
 {
-    Print(*m_os);
+    UpdateRates();
+    if (m_writer != nullptr) {
+        Print(*m_writer);
+    }
+    else {
+        Print(*m_os);
+    }
     Reset();
 
     m_printEvent = Simulator::Schedule(m_period, &L3RateTracer::PeriodicPrinter, this);
@@ -225,27 +208,44 @@ L3RateTracer::PrintHeader(std::ostream& os) const
 void
 L3RateTracer::Reset()
 {
-    for (auto& stats : m_stats) {
-        std::get<0>(stats.second).Reset();
-        std::get<1>(stats.second).Reset();
+    for (auto& entry : m_stats) {
+        std::get<0>(entry.stats).Reset();
+        std::get<1>(entry.stats).Reset();
     }
 }
 
 const double alpha = 0.8;
 
-#define STATS(INDEX) std::get<INDEX>(stats.second)
+#define STATS(INDEX) std::get<INDEX>(entry.stats)
 #define RATE(INDEX, fieldName) STATS(INDEX).fieldName / m_period.ToDouble(Time::S)
 
-#define PRINTER(printName, fieldName)                                                                                  \
+#define UPDATE(fieldName)                                                                                              \
     STATS(2).fieldName = /*new value*/ alpha * RATE(0, fieldName) + /*old value*/ (1 - alpha) * STATS(2).fieldName;    \
     STATS(3).fieldName =                                                                                               \
-      /*new value*/ alpha * RATE(1, fieldName) / 1024.0 + /*old value*/ (1 - alpha) * STATS(3).fieldName;              \
-                                                                                                                       \
+      /*new value*/ alpha * RATE(1, fieldName) / 1024.0 + /*old value*/ (1 - alpha) * STATS(3).fieldName;
+
+void
+L3RateTracer::UpdateRates()
+{
+    // one pass over all faces, separate from formatting
+    for (auto& entry : m_stats) {
+        UPDATE(m_inInterests);
+        UPDATE(m_outInterests);
+        UPDATE(m_inData);
+        UPDATE(m_outData);
+        UPDATE(m_inNack);
+        UPDATE(m_outNack);
+        UPDATE(m_satisfiedInterests);
+        UPDATE(m_timedOutInterests);
+        UPDATE(m_outSatisfiedInterests);
+        UPDATE(m_outTimedOutInterests);
+    }
+}
+
+#define PRINTER(printName, fieldName)                                                                                  \
     os << time.ToDouble(Time::S) << "\t" << m_node << "\t";                                                            \
-    if (stats.first != nfd::face::INVALID_FACEID) {                                                                    \
-        os << stats.first << "\t";                                                                                     \
-        NS_ASSERT(m_faceInfos.find(stats.first) != m_faceInfos.end());                                                 \
-        os << m_faceInfos.find(stats.first)->second << "\t";                                                           \
+    if (entry.faceId != nfd::face::INVALID_FACEID) {                                                                   \
+        os << entry.faceId << "\t" << entry.info << "\t";                                                              \
     }                                                                                                                  \
     else {                                                                                                             \
         os << "-1\tall\t";                                                                                             \
@@ -258,9 +258,11 @@ L3RateTracer::Print(std::ostream& os) const
 {
     Time time = Simulator::Now();
 
-    for (auto& stats : m_stats) {
-        if (stats.first == nfd::face::INVALID_FACEID)
+    // in the order of face IDs, node-wide totals last
+    for (size_t faceId = nfd::face::INVALID_FACEID + 1; faceId < m_faceIndex.size(); ++faceId) {
+        if (m_faceIndex[faceId] == 0)
             continue;
+        const FaceStats& entry = m_stats[m_faceIndex[faceId] - 1];
 
         PRINTER("InInterests", m_inInterests);
         PRINTER("OutInterests", m_outInterests);
@@ -278,116 +280,193 @@ L3RateTracer::Print(std::ostream& os) const
         PRINTER("OutTimedOutInterests", m_outTimedOutInterests);
     }
 
-    {
-        auto i = m_stats.find(nfd::face::INVALID_FACEID);
-        if (i != m_stats.end()) {
-            auto& stats = *i;
-            PRINTER("SatisfiedInterests", m_satisfiedInterests);
-            PRINTER("TimedOutInterests", m_timedOutInterests);
-        }
+    if (!m_faceIndex.empty() && m_faceIndex[nfd::face::INVALID_FACEID] != 0) {
+        const FaceStats& entry = m_stats[m_faceIndex[nfd::face::INVALID_FACEID] - 1];
+        PRINTER("SatisfiedInterests", m_satisfiedInterests);
+        PRINTER("TimedOutInterests", m_timedOutInterests);
+    }
+}
+
+TraceSchema
+L3RateTracer::GetBinarySchema()
+{
+    return {{"Time", TraceColumn::DOUBLE},      {"Node", TraceColumn::STRING},
+            {"FaceId", TraceColumn::INT64},     {"FaceDescr", TraceColumn::STRING},
+            {"Type", TraceColumn::STRING},      {"Packets", TraceColumn::DOUBLE},
+            {"Kilobytes", TraceColumn::DOUBLE}, {"PacketRaw", TraceColumn::DOUBLE},
+            {"KilobytesRaw", TraceColumn::DOUBLE}};
+}
+
+#define BINARY_PRINTER(printName, fieldName)                                                                           \
+    writer.addDouble(time.ToDouble(Time::S)).addString(m_node);                                                        \
+    if (entry.faceId != nfd::face::INVALID_FACEID) {                                                                   \
+        writer.addInt(entry.faceId).addString(entry.info);                                                             \
+    }                                                                                                                  \
+    else {                                                                                                             \
+        writer.addInt(-1).addString("all");                                                                            \
+    }                                                                                                                  \
+    writer.addString(printName)                                                                                        \
+      .addDouble(STATS(2).fieldName)                                                                                   \
+      .addDouble(STATS(3).fieldName)                                                                                   \
+      .addDouble(STATS(0).fieldName)                                                                                   \
+      .addDouble(STATS(1).fieldName / 1024.0);                                                                         \
+    writer.endRecord();
+
+void
+L3RateTracer::Print(BinaryTraceWriter& writer) const
+{
+    Time time = Simulator::Now();
+
+    for (size_t faceId = nfd::face::INVALID_FACEID + 1; faceId < m_faceIndex.size(); ++faceId) {
+        if (m_faceIndex[faceId] == 0)
+            continue;
+        const FaceStats& entry = m_stats[m_faceIndex[faceId] - 1];
+
+        BINARY_PRINTER("InInterests", m_inInterests);
+        BINARY_PRINTER("OutInterests", m_outInterests);
+
+        BINARY_PRINTER("InData", m_inData);
+        BINARY_PRINTER("OutData", m_outData);
+
+        BINARY_PRINTER("InNacks", m_inNack);
+        BINARY_PRINTER("OutNacks", m_outNack);
+
+        BINARY_PRINTER("InSatisfiedInterests", m_satisfiedInterests);
+        BINARY_PRINTER("InTimedOutInterests", m_timedOutInterests);
+
+        BINARY_PRINTER("OutSatisfiedInterests", m_outSatisfiedInterests);
+        BINARY_PRINTER("OutTimedOutInterests", m_outTimedOutInterests);
+    }
+
+    if (!m_faceIndex.empty() && m_faceIndex[nfd::face::INVALID_FACEID] != 0) {
+        const FaceStats& entry = m_stats[m_faceIndex[nfd::face::INVALID_FACEID] - 1];
+        BINARY_PRINTER("SatisfiedInterests", m_satisfiedInterests);
+        BINARY_PRINTER("TimedOutInterests", m_timedOutInterests);
     }
 }
 
 void
 L3RateTracer::OutInterests(const Interest& interest, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_outInterests++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_outInterests++;
     if (interest.hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_outInterests += interest.wireEncode().size();
+        std::get<1>(entry.stats).m_outInterests += interest.wireEncode().size();
     }
 }
 
 void
 L3RateTracer::InInterests(const Interest& interest, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_inInterests++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_inInterests++;
     if (interest.hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_inInterests += interest.wireEncode().size();
+        std::get<1>(entry.stats).m_inInterests += interest.wireEncode().size();
     }
 }
 
 void
 L3RateTracer::OutData(const Data& data, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_outData++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_outData++;
     if (data.hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_outData += data.wireEncode().size();
+        std::get<1>(entry.stats).m_outData += data.wireEncode().size();
     }
 }
 
 void
 L3RateTracer::InData(const Data& data, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_inData++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_inData++;
     if (data.hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_inData += data.wireEncode().size();
+        std::get<1>(entry.stats).m_inData += data.wireEncode().size();
     }
 }
 
 void
 L3RateTracer::OutNack(const lp::Nack& nack, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_outNack++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_outNack++;
     if (nack.getInterest().hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_outNack += nack.getInterest().wireEncode().size();
+        std::get<1>(entry.stats).m_outNack += nack.getInterest().wireEncode().size();
     }
 }
 
 void
 L3RateTracer::InNack(const lp::Nack& nack, const Face& face)
 {
-    AddInfo(face);
-    std::get<0>(m_stats[face.getId()]).m_inNack++;
+    FaceStats& entry = GetStats(face);
+    std::get<0>(entry.stats).m_inNack++;
     if (nack.getInterest().hasWire()) {
-        std::get<1>(m_stats[face.getId()]).m_inNack += nack.getInterest().wireEncode().size();
+        std::get<1>(entry.stats).m_inNack += nack.getInterest().wireEncode().size();
     }
 }
 
 void
 L3RateTracer::SatisfiedInterests(const nfd::pit::Entry& entry, const Face&, const Data&)
 {
-    std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_satisfiedInterests++;
+    std::get<0>(GetTotals().stats).m_satisfiedInterests++;
     // no "size" stats
 
     for (const auto& in : entry.getInRecords()) {
-        AddInfo(in.getFace());
-        std::get<0>(m_stats[(in.getFace()).getId()]).m_satisfiedInterests++;
+        std::get<0>(GetStats(in.getFace()).stats).m_satisfiedInterests++;
     }
 
     for (const auto& out : entry.getOutRecords()) {
-        AddInfo(out.getFace());
-        std::get<0>(m_stats[(out.getFace()).getId()]).m_outSatisfiedInterests++;
+        std::get<0>(GetStats(out.getFace()).stats).m_outSatisfiedInterests++;
     }
 }
 
 void
 L3RateTracer::TimedOutInterests(const nfd::pit::Entry& entry)
 {
-    std::get<0>(m_stats[nfd::face::INVALID_FACEID]).m_timedOutInterests++;
+    std::get<0>(GetTotals().stats).m_timedOutInterests++;
     // no "size" stats
 
     for (const auto& in : entry.getInRecords()) {
-        AddInfo(in.getFace());
-        std::get<0>(m_stats[(in.getFace()).getId()]).m_timedOutInterests++;
+        std::get<0>(GetStats(in.getFace()).stats).m_timedOutInterests++;
     }
 
     for (const auto& out : entry.getOutRecords()) {
-        AddInfo(out.getFace());
-        std::get<0>(m_stats[(out.getFace()).getId()]).m_outTimedOutInterests++;
+        std::get<0>(GetStats(out.getFace()).stats).m_outTimedOutInterests++;
     }
 }
 
-void
-L3RateTracer::AddInfo(const Face& face)
+L3RateTracer::FaceStats&
+L3RateTracer::GetStats(const Face& face)
+{
+    nfd::FaceId faceId = face.getId();
+    if (faceId < m_faceIndex.size() && m_faceIndex[faceId] != 0) {
+        return m_stats[m_faceIndex[faceId] - 1];
+    }
+
+    FaceStats& entry = CreateStats(faceId);
+    entry.info = boost::lexical_cast<std::string>(face.getLocalUri());
+    return entry;
+}
+
+L3RateTracer::FaceStats&
+L3RateTracer::GetTotals()
+{
+    if (!m_faceIndex.empty() && m_faceIndex[nfd::face::INVALID_FACEID] != 0) {
+        return m_stats[m_faceIndex[nfd::face::INVALID_FACEID] - 1];
+    }
+    return CreateStats(nfd::face::INVALID_FACEID);
+}
+
+L3RateTracer::FaceStats&
+L3RateTracer::CreateStats(nfd::FaceId faceId)
 {
-    if (m_faceInfos.find(face.getId()) == m_faceInfos.end()) {
-        m_faceInfos.insert(make_pair(face.getId(), boost::lexical_cast<std::string>(face.getLocalUri())));
+    // face IDs are assigned sequentially by the FaceTable, so the index stays small and dense
+    if (faceId >= m_faceIndex.size()) {
+        m_faceIndex.resize(faceId + 1, 0);
     }
+    m_stats.push_back(FaceStats{faceId});
+    m_faceIndex[faceId] = m_stats.size();
+    return m_stats.back();
 }
 
 } // namespace ndn
@@ -23,6 +23,7 @@
 #include "ns3/ndnSIM/model/ndn-common.hpp"
 
 #include "ndn-l3-tracer.hpp"
+#include "ndn-binary-trace.hpp"
 
 #include "ns3/nstime.h"
 #include "ns3/event-id.h"
@@ -30,6 +31,7 @@
 
 #include <tuple>
 #include <map>
+#include <vector>
 #include <list>
 
 namespace ns3 {
@@ -48,8 +50,10 @@ class L3RateTracer : public L3Tracer {
      * @param averagingPeriod Defines averaging period for the rate calculation,
      *        as well as how often data will be written into the trace file (default, every half
      *second)
+     * @param format TraceFormat::Binary writes BinaryTraceWriter records instead of text
      */
-    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5));
+    static void InstallAll(const std::string& file, Time averagingPeriod = Seconds(0.5),
+                           TraceFormat format = TraceFormat::Text);
 
     /**
      * @brief Helper method to install tracers on the selected simulation nodes
@@ -118,6 +122,16 @@ class L3RateTracer : public L3Tracer {
 
     virtual void Print(std::ostream& os) const;
 
+    /**
+     * @brief Columns of the records written by Print(BinaryTraceWriter&)
+     */
+    static TraceSchema GetBinarySchema();
+
+    /**
+     * @brief Write the same records as Print(std::ostream&) in binary form
+     */
+    void Print(BinaryTraceWriter& writer) const;
+
   protected:
     // from L3Tracer
     virtual void OutInterests(const Interest& interest, const Face& face);
@@ -143,16 +157,38 @@ class L3RateTracer : public L3Tracer {
 
     void Reset();
 
-    void AddInfo(const Face& face);
+    /**
+     * @brief Update the EWMA rates of all faces from the counts of the last period
+     */
+    void UpdateRates();
+
+    struct FaceStats {
+        nfd::FaceId faceId;
+        std::tuple<Stats, Stats, Stats, Stats> stats{}; // packets, bytes, EWMA packets, EWMA kilobytes
+        std::string info; // needed, because face may no longer exists at the time of stat printing
+    };
+
+    /**
+     * @brief Get the statistics of @p face, creating them when the face is seen for the first time
+     */
+    FaceStats& GetStats(const Face& face);
+
+    /**
+     * @brief Get the node-wide statistics (nfd::face::INVALID_FACEID)
+     */
+    FaceStats& GetTotals();
+
+    FaceStats& CreateStats(nfd::FaceId faceId);
 
   private:
     shared_ptr<std::ostream> m_os;
+    shared_ptr<BinaryTraceWriter> m_writer; ///< @brief if set, used instead of m_os
     Time m_period;
     EventId m_printEvent;
 
-    mutable std::map<nfd::FaceId, std::tuple<Stats, Stats, Stats, Stats>> m_stats;
-    std::map<nfd::FaceId, std::string>
-      m_faceInfos; // needed, because face may no longer exists at the time of stat printing
+    /// FaceId => 1 + position in m_stats, 0 if the face has no statistics yet
+    std::vector<uint32_t> m_faceIndex;
+    std::vector<FaceStats> m_stats;
 };
 
 } // namespace ndn